@@ -0,0 +1,80 @@
+#!/bin/bash
+
+# This script checks that hot queries on Messages table use their indexes.
+#
+# PWD must be the root of repository. "sqlite3" command line tool is required.
+# Script creates empty database from SQLite initialization script and runs
+# EXPLAIN QUERY PLAN for each query. Non-zero exit code is returned if
+# any query does not use expected index.
+
+check_plan() {
+  local DB_FILE="$1"
+  local EXPECTED_INDEX="$2"
+  local QUERY="$3"
+
+  local PLAN=$(sqlite3 "$DB_FILE" "EXPLAIN QUERY PLAN $QUERY")
+
+  if echo "$PLAN" | grep -q "INDEX $EXPECTED_INDEX\b"; then
+    echo "OK: $EXPECTED_INDEX"
+    return 0
+  else
+    echo "FAILED: $EXPECTED_INDEX is not used by query:"
+    echo "  $QUERY"
+    echo "$PLAN" | sed 's/^/  /'
+    return 1
+  fi
+}
+
+main() {
+  local ROOT_FOLDER="$(pwd)"
+  local INIT_SCRIPT="$ROOT_FOLDER/resources/sql/db_init_sqlite.sql"
+  local DB_FILE="$(mktemp)"
+  local FAILED=0
+
+  if ! command -v sqlite3 > /dev/null; then
+    echo "sqlite3 is not installed."
+    exit 1
+  fi
+
+  # Placeholders are replaced in the same way as SqliteDriver does.
+  sed -e 's/^-- !$//' \
+      -e 's/\$\$/INTEGER PRIMARY KEY/g' \
+      -e 's/\^\^/BLOB/g' \
+      -e 's/@@//g' "$INIT_SCRIPT" | sqlite3 "$DB_FILE" || exit 1
+
+  # Article counts of feeds.
+  check_plan "$DB_FILE" "Messages_feed" \
+    "SELECT feed, SUM((is_read + 1) % 2), COUNT(*) FROM Messages
+     WHERE feed IN (SELECT custom_id FROM Feeds WHERE category = 1 AND account_id = 1)
+     AND is_deleted = 0 AND is_pdeleted = 0 AND account_id = 1 GROUP BY feed;" || FAILED=1
+
+  # Article list of feed.
+  check_plan "$DB_FILE" "Messages_feed" \
+    "SELECT id FROM Messages
+     WHERE is_deleted = 0 AND is_pdeleted = 0 AND account_id = 1 AND feed = 'feed';" || FAILED=1
+
+  # Lookup of existing articles when storing fetched ones.
+  check_plan "$DB_FILE" "Messages_custom_id" \
+    "SELECT id FROM Messages WHERE account_id = 1 AND custom_id IN ('a', 'b');" || FAILED=1
+
+  check_plan "$DB_FILE" "Messages_feed_title" \
+    "SELECT id FROM Messages WHERE account_id = 1 AND feed = 'feed' AND title IN ('a', 'b');" || FAILED=1
+
+  # Counts of important articles.
+  check_plan "$DB_FILE" "Messages_state" \
+    "SELECT COUNT(*), SUM(is_read) FROM Messages
+     WHERE is_important = 1 AND is_deleted = 0 AND is_pdeleted = 0 AND account_id = 1;" || FAILED=1
+
+  # Purging of old articles.
+  check_plan "$DB_FILE" "Messages_date_created" \
+    "DELETE FROM Messages WHERE account_id = 1 AND date_created < 1000;" || FAILED=1
+
+  # Labels of article.
+  check_plan "$DB_FILE" "LabelsInMessages_message" \
+    "SELECT label FROM LabelsInMessages WHERE message = 1;" || FAILED=1
+
+  rm -f "$DB_FILE"
+  exit $FAILED
+}
+
+main
@@ -4,4 +4,6 @@ CREATE DATABASE IF NOT EXISTS ## CHARACTER SET utf8mb4 COLLATE utf8mb4_unicode_c
 -- !
 USE ##;
 -- !
-!! db_init_sqlite.sql
\ No newline at end of file
+!! db_init_sqlite.sql
+-- !
+!! db_search_mysql.sql
\ No newline at end of file
@@ -59,6 +59,10 @@ CREATE TABLE Feeds (
   custom_id                 TEXT        NOT NULL CHECK (custom_id != ''), /* Custom ID cannot be empty, it must contain either service-specific ID, or Feeds/id. */
   /* Custom column for (serialized) custom account-specific data. */
   custom_data     TEXT,
+  /* Validators of last successful fetch of feed data. */
+  http_etag                 TEXT,
+  http_last_modified        TEXT,
+  content_hash              TEXT,
   
   FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
 );
@@ -80,11 +84,20 @@ CREATE TABLE Messages (
   account_id      INTEGER     NOT NULL,
   custom_id       TEXT,
   custom_hash     TEXT,
-  labels          TEXT        NOT NULL DEFAULT ".", /* Holds list of assigned label IDs. */
   
   FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
 );
 -- !
+CREATE INDEX Messages_feed ON Messages (account_id, feed@@, is_deleted, is_pdeleted, is_read);
+-- !
+CREATE INDEX Messages_feed_title ON Messages (account_id, feed@@, title@@);
+-- !
+CREATE INDEX Messages_custom_id ON Messages (account_id, custom_id@@);
+-- !
+CREATE INDEX Messages_state ON Messages (account_id, is_deleted, is_pdeleted, is_read, is_important);
+-- !
+CREATE INDEX Messages_date_created ON Messages (account_id, date_created);
+-- !
 CREATE TABLE MessageFilters (
   id                  $$,
   name                TEXT        NOT NULL CHECK (name != ''),
@@ -110,12 +123,54 @@ CREATE TABLE Labels (
   FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
 );
 -- !
+CREATE TABLE LabelsInMessages (
+  label               TEXT        NOT NULL, /* Points to Labels/custom_id. */
+  message             INTEGER     NOT NULL, /* Points to Messages/id. */
+  account_id          INTEGER     NOT NULL,
+  
+  FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
+);
+-- !
+CREATE UNIQUE INDEX LabelsInMessages_label ON LabelsInMessages (account_id, label@@, message);
+-- !
+CREATE INDEX LabelsInMessages_message ON LabelsInMessages (message);
+-- !
+CREATE INDEX Labels_custom_id ON Labels (account_id, custom_id@@);
+-- !
+/* Label assignments of removed articles are removed too. */
+CREATE TRIGGER LabelsInMessages_cleanup AFTER DELETE ON Messages
+FOR EACH ROW
+BEGIN
+  DELETE FROM LabelsInMessages WHERE message = OLD.id;
+END;
+-- !
 CREATE TABLE Probes (
   id                  $$,
   name                TEXT        NOT NULL CHECK (name != ''),
   color               VARCHAR(7)  NOT NULL CHECK (color != ''),
-  fltr                TEXT        NOT NULL CHECK (fltr != ''), /* Regular expression. */
+  fltr                TEXT        NOT NULL CHECK (fltr != ''), /* Filter of given type. */
   account_id          INTEGER     NOT NULL,
+  /* Must stay last, upgraded databases have it appended by ALTER TABLE. */
+  fltr_type           INTEGER     NOT NULL DEFAULT 0 CHECK (fltr_type >= 0), /* Regular expression or full-text query. */
   
   FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
-);
\ No newline at end of file
+);
+-- !
+CREATE TABLE ProbesInMessages (
+  probe               INTEGER     NOT NULL, /* Points to Probes/id. */
+  message             INTEGER     NOT NULL, /* Points to Messages/id. */
+  account_id          INTEGER     NOT NULL,
+  
+  FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
+);
+-- !
+CREATE UNIQUE INDEX ProbesInMessages_probe ON ProbesInMessages (account_id, probe, message);
+-- !
+CREATE INDEX ProbesInMessages_message ON ProbesInMessages (message);
+-- !
+/* Probe hits of removed articles are removed too. */
+CREATE TRIGGER ProbesInMessages_cleanup AFTER DELETE ON Messages
+FOR EACH ROW
+BEGIN
+  DELETE FROM ProbesInMessages WHERE message = OLD.id;
+END;
\ No newline at end of file
@@ -0,0 +1,2 @@
+/* Full-text index of articles. */
+CREATE FULLTEXT INDEX Messages_search ON Messages (title, author, contents, url);
\ No newline at end of file
@@ -0,0 +1,7 @@
+/* Full-text index of articles. */
+CREATE VIRTUAL TABLE MessagesSearch USING fts5(title, author, contents, url, content = 'Messages', content_rowid = 'id');
+-- !
+!! db_search_triggers_sqlite.sql
+-- !
+/* Index already existing articles. */
+INSERT INTO MessagesSearch (MessagesSearch) VALUES ('rebuild');
\ No newline at end of file
@@ -0,0 +1,23 @@
+/* Triggers keep full-text index in sync with Messages. */
+CREATE TRIGGER MessagesSearch_insert AFTER INSERT ON Messages
+FOR EACH ROW
+BEGIN
+  INSERT INTO MessagesSearch (rowid, title, author, contents, url)
+  VALUES (NEW.id, NEW.title, NEW.author, NEW.contents, NEW.url);
+END;
+-- !
+CREATE TRIGGER MessagesSearch_delete AFTER DELETE ON Messages
+FOR EACH ROW
+BEGIN
+  INSERT INTO MessagesSearch (MessagesSearch, rowid, title, author, contents, url)
+  VALUES ('delete', OLD.id, OLD.title, OLD.author, OLD.contents, OLD.url);
+END;
+-- !
+CREATE TRIGGER MessagesSearch_update AFTER UPDATE OF title, author, contents, url ON Messages
+FOR EACH ROW
+BEGIN
+  INSERT INTO MessagesSearch (MessagesSearch, rowid, title, author, contents, url)
+  VALUES ('delete', OLD.id, OLD.title, OLD.author, OLD.contents, OLD.url);
+  INSERT INTO MessagesSearch (rowid, title, author, contents, url)
+  VALUES (NEW.id, NEW.title, NEW.author, NEW.contents, NEW.url);
+END;
\ No newline at end of file
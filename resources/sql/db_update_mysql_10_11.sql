@@ -0,0 +1,3 @@
+USE ##;
+-- !
+!! db_update_sqlite_10_11.sql
\ No newline at end of file
@@ -0,0 +1,6 @@
+USE ##;
+-- !
+/* Add type of probe filter. */
+ALTER TABLE Probes ADD fltr_type INTEGER NOT NULL DEFAULT 0 CHECK (fltr_type >= 0);
+-- !
+!! db_search_mysql.sql
\ No newline at end of file
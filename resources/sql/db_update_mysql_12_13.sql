@@ -0,0 +1,3 @@
+USE ##;
+-- !
+!! db_update_sqlite_12_13.sql
\ No newline at end of file
@@ -0,0 +1,3 @@
+USE ##;
+-- !
+!! db_update_sqlite_8_9.sql
\ No newline at end of file
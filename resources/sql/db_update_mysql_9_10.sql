@@ -0,0 +1,29 @@
+USE ##;
+-- !
+CREATE TABLE LabelsInMessages (
+  label               TEXT        NOT NULL, /* Points to Labels/custom_id. */
+  message             INTEGER     NOT NULL, /* Points to Messages/id. */
+  account_id          INTEGER     NOT NULL,
+  
+  FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
+);
+-- !
+INSERT INTO LabelsInMessages (label, message, account_id)
+SELECT DISTINCT Labels.custom_id, Messages.id, Messages.account_id
+FROM Messages
+INNER JOIN Labels ON Labels.account_id = Messages.account_id AND Messages.labels LIKE CONCAT('%.', Labels.custom_id, '.%');
+-- !
+ALTER TABLE Messages DROP COLUMN labels;
+-- !
+CREATE UNIQUE INDEX LabelsInMessages_label ON LabelsInMessages (account_id, label@@, message);
+-- !
+CREATE INDEX LabelsInMessages_message ON LabelsInMessages (message);
+-- !
+CREATE INDEX Labels_custom_id ON Labels (account_id, custom_id@@);
+-- !
+/* Label assignments of removed articles are removed too. */
+CREATE TRIGGER LabelsInMessages_cleanup AFTER DELETE ON Messages
+FOR EACH ROW
+BEGIN
+  DELETE FROM LabelsInMessages WHERE message = OLD.id;
+END;
\ No newline at end of file
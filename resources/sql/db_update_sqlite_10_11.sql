@@ -0,0 +1,6 @@
+/* Add columns with validators of last successful fetch of feed data. */
+ALTER TABLE Feeds ADD http_etag TEXT;
+-- !
+ALTER TABLE Feeds ADD http_last_modified TEXT;
+-- !
+ALTER TABLE Feeds ADD content_hash TEXT;
\ No newline at end of file
@@ -0,0 +1,2 @@
+/* Add type of probe filter, full-text index is created on startup if SQLite supports it. */
+ALTER TABLE Probes ADD fltr_type INTEGER NOT NULL DEFAULT 0 CHECK (fltr_type >= 0);
\ No newline at end of file
@@ -0,0 +1,24 @@
+CREATE TABLE ProbesInMessages (
+  probe               INTEGER     NOT NULL, /* Points to Probes/id. */
+  message             INTEGER     NOT NULL, /* Points to Messages/id. */
+  account_id          INTEGER     NOT NULL,
+  
+  FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
+);
+-- !
+CREATE UNIQUE INDEX ProbesInMessages_probe ON ProbesInMessages (account_id, probe, message);
+-- !
+CREATE INDEX ProbesInMessages_message ON ProbesInMessages (message);
+-- !
+/* Probe hits of removed articles are removed too. */
+CREATE TRIGGER ProbesInMessages_cleanup AFTER DELETE ON Messages
+FOR EACH ROW
+BEGIN
+  DELETE FROM ProbesInMessages WHERE message = OLD.id;
+END;
+-- !
+/* Remember hits of existing regular expression probes. */
+INSERT INTO ProbesInMessages (probe, message, account_id)
+SELECT Probes.id, Messages.id, Messages.account_id
+FROM Probes JOIN Messages ON Messages.account_id = Probes.account_id
+WHERE Probes.fltr_type = 0 AND (Messages.title REGEXP Probes.fltr OR Messages.contents REGEXP Probes.fltr);
\ No newline at end of file
@@ -0,0 +1,9 @@
+CREATE INDEX Messages_feed ON Messages (account_id, feed@@, is_deleted, is_pdeleted, is_read);
+-- !
+CREATE INDEX Messages_feed_title ON Messages (account_id, feed@@, title@@);
+-- !
+CREATE INDEX Messages_custom_id ON Messages (account_id, custom_id@@);
+-- !
+CREATE INDEX Messages_state ON Messages (account_id, is_deleted, is_pdeleted, is_read, is_important);
+-- !
+CREATE INDEX Messages_date_created ON Messages (account_id, date_created);
\ No newline at end of file
@@ -0,0 +1,64 @@
+ALTER TABLE Messages RENAME TO backup_Messages;
+-- !
+CREATE TABLE Messages (
+  id              $$,
+  is_read         INTEGER     NOT NULL DEFAULT 0 CHECK (is_read >= 0 AND is_read <= 1),
+  is_important    INTEGER     NOT NULL DEFAULT 0 CHECK (is_important >= 0 AND is_important <= 1),
+  is_deleted      INTEGER     NOT NULL DEFAULT 0 CHECK (is_deleted >= 0 AND is_deleted <= 1),
+  is_pdeleted     INTEGER     NOT NULL DEFAULT 0 CHECK (is_pdeleted >= 0 AND is_pdeleted <= 1),
+  feed            TEXT        NOT NULL, /* Points to Feeds/custom_id. */
+  title           TEXT        NOT NULL CHECK (title != ''),
+  url             TEXT,
+  author          TEXT,
+  date_created    BIGINT      NOT NULL CHECK (date_created >= 0),
+  contents        TEXT,
+  enclosures      TEXT,
+  score           REAL        NOT NULL DEFAULT 0.0 CHECK (score >= 0.0 AND score <= 100.0),
+  account_id      INTEGER     NOT NULL,
+  custom_id       TEXT,
+  custom_hash     TEXT,
+  
+  FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
+);
+-- !
+INSERT INTO Messages (id, is_read, is_important, is_deleted, is_pdeleted, feed, title, url, author, date_created, contents, enclosures, score, account_id, custom_id, custom_hash)
+SELECT id, is_read, is_important, is_deleted, is_pdeleted, feed, title, url, author, date_created, contents, enclosures, score, account_id, custom_id, custom_hash
+FROM backup_Messages;
+-- !
+CREATE TABLE LabelsInMessages (
+  label               TEXT        NOT NULL, /* Points to Labels/custom_id. */
+  message             INTEGER     NOT NULL, /* Points to Messages/id. */
+  account_id          INTEGER     NOT NULL,
+  
+  FOREIGN KEY (account_id) REFERENCES Accounts (id) ON DELETE CASCADE
+);
+-- !
+INSERT INTO LabelsInMessages (label, message, account_id)
+SELECT DISTINCT Labels.custom_id, backup_Messages.id, backup_Messages.account_id
+FROM backup_Messages
+INNER JOIN Labels ON Labels.account_id = backup_Messages.account_id AND backup_Messages.labels LIKE ('%.' || Labels.custom_id || '.%');
+-- !
+DROP TABLE backup_Messages;
+-- !
+CREATE INDEX Messages_feed ON Messages (account_id, feed@@, is_deleted, is_pdeleted, is_read);
+-- !
+CREATE INDEX Messages_feed_title ON Messages (account_id, feed@@, title@@);
+-- !
+CREATE INDEX Messages_custom_id ON Messages (account_id, custom_id@@);
+-- !
+CREATE INDEX Messages_state ON Messages (account_id, is_deleted, is_pdeleted, is_read, is_important);
+-- !
+CREATE INDEX Messages_date_created ON Messages (account_id, date_created);
+-- !
+CREATE UNIQUE INDEX LabelsInMessages_label ON LabelsInMessages (account_id, label@@, message);
+-- !
+CREATE INDEX LabelsInMessages_message ON LabelsInMessages (message);
+-- !
+CREATE INDEX Labels_custom_id ON Labels (account_id, custom_id@@);
+-- !
+/* Label assignments of removed articles are removed too. */
+CREATE TRIGGER LabelsInMessages_cleanup AFTER DELETE ON Messages
+FOR EACH ROW
+BEGIN
+  DELETE FROM LabelsInMessages WHERE message = OLD.id;
+END;
\ No newline at end of file
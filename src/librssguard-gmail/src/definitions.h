@@ -23,6 +23,15 @@
 #define GMAIL_DEFAULT_BATCH_SIZE 100
 #define GMAIL_MAX_BATCH_SIZE     999
 
+// Number of e-mails in single multipart batch request and
+// number of such batch requests downloaded at once.
+#define GMAIL_MESSAGES_BATCH_SIZE     100
+#define GMAIL_MESSAGES_BATCH_PARALLEL 4
+
+// E-mails downloaded without their bodies start with this marker,
+// their full bodies are downloaded when they are opened.
+#define GMAIL_SNIPPET_MARKER "<!-- gmail-snippet -->"
+
 #define GMAIL_LABEL_TYPE_USER "user"
 
 #define GMAIL_SYSTEM_LABEL_UNREAD  "UNREAD"
@@ -21,16 +21,21 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QThreadPool>
 #include <QUrl>
+#include <QtConcurrentRun>
+
+#include <atomic>
 
 GmailNetworkFactory::GmailNetworkFactory(QObject* parent)
   : QObject(parent), m_service(nullptr), m_username(QString()), m_batchSize(GMAIL_DEFAULT_BATCH_SIZE),
-    m_downloadOnlyUnreadMessages(false), m_oauth2(new OAuth2Service(QSL(GMAIL_OAUTH_AUTH_URL),
-                                                                    QSL(GMAIL_OAUTH_TOKEN_URL),
-                                                                    {},
-                                                                    {},
-                                                                    QSL(GMAIL_OAUTH_SCOPE),
-                                                                    this)) {
+    m_downloadOnlyUnreadMessages(false), m_lazyMessageBodies(false),
+    m_oauth2(new OAuth2Service(QSL(GMAIL_OAUTH_AUTH_URL),
+                               QSL(GMAIL_OAUTH_TOKEN_URL),
+                               {},
+                               {},
+                               QSL(GMAIL_OAUTH_SCOPE),
+                               this)) {
   initializeOauth();
 }
 
@@ -147,6 +152,14 @@ void GmailNetworkFactory::setDownloadOnlyUnreadMessages(bool download_only_unrea
   m_downloadOnlyUnreadMessages = download_only_unread_messages;
 }
 
+bool GmailNetworkFactory::lazyMessageBodies() const {
+  return m_lazyMessageBodies;
+}
+
+void GmailNetworkFactory::setLazyMessageBodies(bool lazy_message_bodies) {
+  m_lazyMessageBodies = lazy_message_bodies;
+}
+
 QList<RootItem*> GmailNetworkFactory::labels(bool only_user_labels, const QNetworkProxy& custom_proxy) {
   QString bearer = m_oauth2->bearer().toLocal8Bit();
 
@@ -511,7 +524,11 @@ void GmailNetworkFactory::onAuthFailed() {
                         }});
 }
 
-bool GmailNetworkFactory::fillFullMessage(Message& msg, const QJsonObject& json, const QString& feed_id) {
+bool GmailNetworkFactory::fillFullMessage(Message& msg,
+                                          const QJsonObject& json,
+                                          const QString& feed_id,
+                                          const QList<Label*>& active_labels,
+                                          QString& date_time_format) const {
   // Assign correct main labels/states.
   auto labelids = json[QSL("labelIds")].toArray().toVariantList();
 
@@ -539,7 +556,6 @@ bool GmailNetworkFactory::fillFullMessage(Message& msg, const QJsonObject& json,
   msg.m_isRead = true;
   msg.m_rawContents = QJsonDocument(json).toJson(QJsonDocument::JsonFormat::Compact);
 
-  auto active_labels = m_service->labelsNode() != nullptr ? m_service->labelsNode()->labels() : QList<Label*>();
   auto active_labels_linq = boolinq::from(active_labels);
 
   for (const QVariant& label : std::as_const(labelids)) {
@@ -569,10 +585,10 @@ bool GmailNetworkFactory::fillFullMessage(Message& msg, const QJsonObject& json,
   msg.m_url = QSL("https://mail.google.com/mail/u/0/#all/%1").arg(msg.m_customId);
 
   msg.m_createdFromFeed = true;
-  msg.m_created = TextFactory::parseDateTime(headers[QSL("Date")], &m_dateTimeFormat);
+  msg.m_created = TextFactory::parseDateTime(headers[QSL("Date")], &date_time_format);
 
   if (!msg.m_created.isValid()) {
-    msg.m_created = TextFactory::parseDateTime(headers[QSL("date")], &m_dateTimeFormat);
+    msg.m_created = TextFactory::parseDateTime(headers[QSL("date")], &date_time_format);
   }
 
   if (msg.m_title.isEmpty()) {
@@ -644,6 +660,11 @@ bool GmailNetworkFactory::fillFullMessage(Message& msg, const QJsonObject& json,
     msg.m_contents = backup_contents;
   }
 
+  if (msg.m_contents.isEmpty() && !json[QSL("payload")].toObject().contains(QSL("body"))) {
+    // Only metadata of the e-mail were downloaded, full body is downloaded when e-mail is opened.
+    msg.m_contents = QSL(GMAIL_SNIPPET_MARKER) + json[QSL("snippet")].toString();
+  }
+
   return true;
 }
 
@@ -696,77 +717,176 @@ QMap<QString, QString> GmailNetworkFactory::getMessageMetadata(const QString& ms
 QList<Message> GmailNetworkFactory::obtainAndDecodeFullMessages(const QStringList& message_ids,
                                                                 const QString& feed_id,
                                                                 const QNetworkProxy& custom_proxy) {
-  QHash<QString, Message> msgs;
-  int next_message = 0;
   QString bearer = m_oauth2->bearer();
 
   if (bearer.isEmpty()) {
     return {};
   }
 
-  do {
-    QHttpMultiPart multi;
+  QList<Label*> active_labels =
+    m_service->labelsNode() != nullptr ? m_service->labelsNode()->labels() : QList<Label*>();
+  QList<QFuture<MessagesBatch>> batches;
+  QThreadPool pool;
+  std::atomic_bool failed(false);
+
+  pool.setMaxThreadCount(GMAIL_MESSAGES_BATCH_PARALLEL);
+
+  for (int i = 0; i < message_ids.size(); i += GMAIL_MESSAGES_BATCH_SIZE) {
+    QStringList batch_ids = message_ids.mid(i, GMAIL_MESSAGES_BATCH_SIZE);
 
-    multi.setContentType(QHttpMultiPart::ContentType::MixedType);
+    batches.append(QtConcurrent::run(&pool, [=, &failed]() {
+      if (failed) {
+        return MessagesBatch();
+      }
+
+      MessagesBatch batch =
+        obtainAndDecodeMessagesBatch(batch_ids, feed_id, bearer, active_labels, m_dateTimeFormat, custom_proxy);
+
+      if (batch.m_networkError != QNetworkReply::NetworkError::NoError) {
+        failed = true;
+      }
 
-    for (int window = next_message + 100; next_message < window && next_message < message_ids.size(); next_message++) {
-      QString msg_id = message_ids[next_message];
-      Message msg;
-      QHttpPart part;
+      return batch;
+    }));
+  }
 
-      msg.m_feedId = feed_id;
-      msg.m_customId = msg_id;
+  QList<Message> msgs;
 
-      part.setRawHeader(HTTP_HEADERS_CONTENT_TYPE, GMAIL_CONTENT_TYPE_HTTP);
-      QString full_msg_endpoint = QSL("GET /gmail/v1/users/me/messages/%1\r\n").arg(msg_id);
+  for (QFuture<MessagesBatch>& batch : batches) {
+    batch.waitForFinished();
 
-      part.setBody(full_msg_endpoint.toUtf8());
-      multi.append(part);
-      msgs.insert(msg_id, msg);
+    if (!failed) {
+      msgs.append(batch.result().m_messages);
     }
+  }
 
-    QList<QPair<QByteArray, QByteArray>> headers;
-    QList<HttpResponse> output;
-    int timeout = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::UpdateTimeout)).toInt();
-
-    headers.append(QPair<QByteArray, QByteArray>(QSL(HTTP_HEADERS_AUTHORIZATION).toLocal8Bit(), bearer.toLocal8Bit()));
-
-    NetworkResult res = NetworkFactory::performNetworkOperation(GMAIL_API_BATCH,
-                                                                timeout,
-                                                                &multi,
-                                                                output,
-                                                                QNetworkAccessManager::Operation::PostOperation,
-                                                                headers,
-                                                                false,
-                                                                {},
-                                                                {},
-                                                                custom_proxy);
-
-    if (res.m_networkError == QNetworkReply::NetworkError::NoError) {
-      // We parse each part of HTTP response (it contains HTTP headers and payload with msg full data).
-      for (const HttpResponse& part : std::as_const(output)) {
-        QJsonObject msg_doc = QJsonDocument::fromJson(part.body().toUtf8()).object();
-        QString msg_id = msg_doc[QSL("id")].toString();
-
-        if (msgs.contains(msg_id)) {
-          Message& msg = msgs[msg_id];
-
-          if (!fillFullMessage(msg, msg_doc, feed_id)) {
-            qWarningNN << LOGSEC_GMAIL << "Failed to get (or deliberately skipped) full message for custom ID:"
-                       << QUOTE_W_SPACE_DOT(msg.m_customId);
-
-            msgs.remove(msg_id);
-          }
-        }
+  if (failed) {
+    return {};
+  }
+
+  return msgs;
+}
+
+GmailNetworkFactory::MessagesBatch GmailNetworkFactory::obtainAndDecodeMessagesBatch(
+  const QStringList& message_ids,
+  const QString& feed_id,
+  const QString& bearer,
+  const QList<Label*>& active_labels,
+  QString date_time_format,
+  const QNetworkProxy& custom_proxy) const {
+  QHash<QString, Message> msgs;
+  QHttpMultiPart multi;
+
+  multi.setContentType(QHttpMultiPart::ContentType::MixedType);
+
+  for (const QString& msg_id : message_ids) {
+    Message msg;
+    QHttpPart part;
+
+    msg.m_feedId = feed_id;
+    msg.m_customId = msg_id;
+
+    part.setRawHeader(HTTP_HEADERS_CONTENT_TYPE, GMAIL_CONTENT_TYPE_HTTP);
+    QString full_msg_endpoint =
+      m_lazyMessageBodies
+        ? QSL("GET /gmail/v1/users/me/messages/%1?format=metadata&metadataHeaders=From&metadataHeaders=Subject&"
+              "metadataHeaders=Date\r\n")
+            .arg(msg_id)
+        : QSL("GET /gmail/v1/users/me/messages/%1\r\n").arg(msg_id);
+
+    part.setBody(full_msg_endpoint.toUtf8());
+    multi.append(part);
+    msgs.insert(msg_id, msg);
+  }
+
+  QList<QPair<QByteArray, QByteArray>> headers;
+  QList<HttpResponse> output;
+  int timeout = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::UpdateTimeout)).toInt();
+
+  headers.append(QPair<QByteArray, QByteArray>(QSL(HTTP_HEADERS_AUTHORIZATION).toLocal8Bit(), bearer.toLocal8Bit()));
+
+  NetworkResult res = NetworkFactory::performNetworkOperation(GMAIL_API_BATCH,
+                                                              timeout,
+                                                              &multi,
+                                                              output,
+                                                              QNetworkAccessManager::Operation::PostOperation,
+                                                              headers,
+                                                              false,
+                                                              {},
+                                                              {},
+                                                              custom_proxy);
+  MessagesBatch batch;
+
+  batch.m_networkError = res.m_networkError;
+
+  if (res.m_networkError != QNetworkReply::NetworkError::NoError) {
+    return batch;
+  }
+
+  // We parse each part of HTTP response (it contains HTTP headers and payload with msg full data).
+  for (const HttpResponse& part : std::as_const(output)) {
+    QJsonObject msg_doc = QJsonDocument::fromJson(part.body().toUtf8()).object();
+    QString msg_id = msg_doc[QSL("id")].toString();
+
+    if (msgs.contains(msg_id)) {
+      Message& msg = msgs[msg_id];
+
+      if (!fillFullMessage(msg, msg_doc, feed_id, active_labels, date_time_format)) {
+        qWarningNN << LOGSEC_GMAIL << "Failed to get (or deliberately skipped) full message for custom ID:"
+                   << QUOTE_W_SPACE_DOT(msg.m_customId);
+
+        msgs.remove(msg_id);
       }
     }
-    else {
-      return {};
-    }
   }
-  while (next_message < message_ids.size());
 
-  return msgs.values();
+  batch.m_messages = msgs.values();
+  return batch;
+}
+
+Message GmailNetworkFactory::fullMessage(const Message& msg, const QNetworkProxy& custom_proxy) {
+  QString bearer = m_oauth2->bearer();
+
+  if (bearer.isEmpty()) {
+    throw ApplicationException(tr("you are not logged in"));
+  }
+
+  QList<QPair<QByteArray, QByteArray>> headers;
+  QByteArray output;
+  int timeout = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::UpdateTimeout)).toInt();
+
+  headers.append(QPair<QByteArray, QByteArray>(QSL(HTTP_HEADERS_AUTHORIZATION).toLocal8Bit(), bearer.toLocal8Bit()));
+
+  QString query = QSL("%1/%2").arg(QSL(GMAIL_API_MSGS_LIST), msg.m_customId);
+  NetworkResult res = NetworkFactory::performNetworkOperation(query,
+                                                              timeout,
+                                                              QByteArray(),
+                                                              output,
+                                                              QNetworkAccessManager::Operation::GetOperation,
+                                                              headers,
+                                                              false,
+                                                              {},
+                                                              {},
+                                                              custom_proxy);
+
+  if (res.m_networkError != QNetworkReply::NetworkError::NoError) {
+    throw NetworkException(res.m_networkError, tr("failed to download e-mail"));
+  }
+
+  QList<Label*> active_labels =
+    m_service->labelsNode() != nullptr ? m_service->labelsNode()->labels() : QList<Label*>();
+  Message full_msg;
+
+  full_msg.m_feedId = msg.m_feedId;
+  full_msg.m_customId = msg.m_customId;
+
+  QJsonObject msg_doc = QJsonDocument::fromJson(output).object();
+
+  if (!fillFullMessage(full_msg, msg_doc, msg.m_feedId, active_labels, m_dateTimeFormat)) {
+    throw ApplicationException(tr("e-mail was moved to another label"));
+  }
+
+  return full_msg;
 }
 
 QStringList GmailNetworkFactory::decodeLiteMessages(const QString& messages_json_data, QString& next_page_token) const {
@@ -38,12 +38,20 @@ class GmailNetworkFactory : public QObject {
     bool downloadOnlyUnreadMessages() const;
     void setDownloadOnlyUnreadMessages(bool download_only_unread_messages);
 
+    // Only headers and snippets of e-mails are downloaded during
+    // feed updates, full bodies are downloaded later on demand.
+    bool lazyMessageBodies() const;
+    void setLazyMessageBodies(bool lazy_message_bodies);
+
     // API methods.
     QList<RootItem*> labels(bool only_user_labels, const QNetworkProxy& custom_proxy);
     QMap<QString, QString> getMessageMetadata(const QString& msg_id,
                                               const QStringList& metadata,
                                               const QNetworkProxy& custom_proxy);
     QNetworkRequest requestForAttachment(const QString& email_id, const QString& attachment_id);
+
+    // Downloads full body and attachments of e-mail which was downloaded without them.
+    Message fullMessage(const Message& msg, const QNetworkProxy& custom_proxy);
     QString sendEmail(Mimesis::Message msg, const QNetworkProxy& custom_proxy, Message* reply_to_message = nullptr);
     QList<Message> messages(const QString& stream_id,
                             const QHash<ServiceRoot::BagOfMessages, QStringList>& stated_messages,
@@ -74,10 +82,27 @@ class GmailNetworkFactory : public QObject {
     void onAuthFailed();
 
   private:
-    bool fillFullMessage(Message& msg, const QJsonObject& json, const QString& feed_id);
+    struct MessagesBatch {
+        QList<Message> m_messages;
+        QNetworkReply::NetworkError m_networkError = QNetworkReply::NetworkError::NoError;
+    };
+
+    bool fillFullMessage(Message& msg,
+                         const QJsonObject& json,
+                         const QString& feed_id,
+                         const QList<Label*>& active_labels,
+                         QString& date_time_format) const;
     QList<Message> obtainAndDecodeFullMessages(const QStringList& message_ids,
                                                const QString& feed_id,
                                                const QNetworkProxy& custom_proxy);
+
+    // Downloads and decodes one batch of e-mails, this is called from worker threads.
+    MessagesBatch obtainAndDecodeMessagesBatch(const QStringList& message_ids,
+                                               const QString& feed_id,
+                                               const QString& bearer,
+                                               const QList<Label*>& active_labels,
+                                               QString date_time_format,
+                                               const QNetworkProxy& custom_proxy) const;
     QStringList decodeLiteMessages(const QString& messages_json_data, QString& next_page_token) const;
     QString sanitizeEmailAuthor(const QString& author) const;
 
@@ -89,6 +114,7 @@ class GmailNetworkFactory : public QObject {
     QString m_dateTimeFormat;
     int m_batchSize;
     bool m_downloadOnlyUnreadMessages;
+    bool m_lazyMessageBodies;
     OAuth2Service* m_oauth2;
 };
 
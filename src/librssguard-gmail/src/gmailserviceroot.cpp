@@ -78,6 +78,7 @@ QVariantHash GmailServiceRoot::customDatabaseData() const {
   data[QSL("username")] = m_network->username();
   data[QSL("batch_size")] = m_network->batchSize();
   data[QSL("download_only_unread")] = m_network->downloadOnlyUnreadMessages();
+  data[QSL("lazy_message_bodies")] = m_network->lazyMessageBodies();
   data[QSL("client_id")] = m_network->oauth()->clientId();
   data[QSL("client_secret")] = m_network->oauth()->clientSecret();
   data[QSL("refresh_token")] = m_network->oauth()->refreshToken();
@@ -92,6 +93,7 @@ void GmailServiceRoot::setCustomDatabaseData(const QVariantHash& data) {
   m_network->setUsername(data[QSL("username")].toString());
   m_network->setBatchSize(data[QSL("batch_size")].toInt());
   m_network->setDownloadOnlyUnreadMessages(data[QSL("download_only_unread")].toBool());
+  m_network->setLazyMessageBodies(data[QSL("lazy_message_bodies")].toBool());
   m_network->oauth()->setClientId(data[QSL("client_id")].toString());
   m_network->oauth()->setClientSecret(data[QSL("client_secret")].toString());
   m_network->oauth()->setRefreshToken(data[QSL("refresh_token")].toString());
@@ -7,6 +7,8 @@
 #include "src/gmailserviceroot.h"
 #include "src/gui/formaddeditemail.h"
 
+#include <librssguard/core/probeengine.h>
+#include <librssguard/database/databasequeries.h>
 #include <librssguard/exceptions/networkexception.h>
 #include <librssguard/gui/messagebox.h>
 #include <librssguard/miscellaneous/application.h>
@@ -50,23 +52,29 @@ void EmailPreviewer::clear() {
 
 void EmailPreviewer::loadMessage(const Message& msg, RootItem* selected_item) {
   m_message = msg;
-  m_webView->loadMessages({msg}, selected_item);
+  m_selectedItem = selected_item;
+
+  displayMessage();
 
-  m_ui.m_tbFrom->setText(msg.m_author);
-  m_ui.m_tbSubject->setText(msg.m_title);
   m_ui.m_tbTo->setText(QSL("-"));
+  m_tmrLoadExtraMessageData.start();
+}
+
+void EmailPreviewer::displayMessage() {
+  m_webView->loadMessages({m_message}, m_selectedItem.data());
+
+  m_ui.m_tbFrom->setText(m_message.m_author);
+  m_ui.m_tbSubject->setText(m_message.m_title);
 
   m_ui.m_btnAttachments->menu()->clear();
 
-  for (const Enclosure& att : msg.m_enclosures) {
+  for (const Enclosure& att : std::as_const(m_message.m_enclosures)) {
     const QStringList att_id_name = att.m_url.split(QSL(GMAIL_ATTACHMENT_SEP));
 
     m_ui.m_btnAttachments->menu()->addAction(att.m_mimeType)->setData(att_id_name);
   }
 
   m_ui.m_btnAttachments->setDisabled(m_ui.m_btnAttachments->menu()->isEmpty());
-
-  m_tmrLoadExtraMessageData.start();
 }
 
 void EmailPreviewer::loadExtraMessageData() {
@@ -78,6 +86,29 @@ void EmailPreviewer::loadExtraMessageData() {
   catch (const ApplicationException& ex) {
     qWarningNN << LOGSEC_GMAIL << "Cannot load extra article metadata:" << QUOTE_W_SPACE_DOT(ex.message());
   }
+
+  if (!m_message.m_contents.startsWith(QSL(GMAIL_SNIPPET_MARKER))) {
+    return;
+  }
+
+  // Only snippet of the e-mail was downloaded, now we get full body and store it.
+  try {
+    Message msg = m_message;
+    Message full_msg = m_account->network()->fullMessage(msg, m_account->networkProxy());
+    QSqlDatabase database = qApp->database()->driver()->connection(metaObject()->className());
+
+    msg.m_contents = full_msg.m_contents;
+    msg.m_enclosures = full_msg.m_enclosures;
+
+    DatabaseQueries::updateMessageContents(database, msg);
+    ProbeEngine::forCurrentThread()->matchArticles(database, m_account->accountId(), {msg});
+
+    m_message = msg;
+    displayMessage();
+  }
+  catch (const ApplicationException& ex) {
+    qWarningNN << LOGSEC_GMAIL << "Cannot load full e-mail:" << QUOTE_W_SPACE_DOT(ex.message());
+  }
 }
 
 void EmailPreviewer::replyToEmail() {
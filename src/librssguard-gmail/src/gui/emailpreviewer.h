@@ -8,6 +8,7 @@
 #include <librssguard/gui/webbrowser.h>
 #include <librssguard/services/abstract/gui/custommessagepreviewer.h>
 
+#include <QPointer>
 #include <QTimer>
 
 class GmailServiceRoot;
@@ -28,11 +29,15 @@ class EmailPreviewer : public CustomMessagePreviewer {
     void forwardEmail();
     void downloadAttachment(QAction* act);
 
+  private:
+    void displayMessage();
+
   private:
     Ui::EmailPreviewer m_ui;
     GmailServiceRoot* m_account;
     QScopedPointer<WebBrowser> m_webView;
     Message m_message;
+    QPointer<RootItem> m_selectedItem;
     QTimer m_tmrLoadExtraMessageData;
 };
 
@@ -37,6 +37,7 @@ void FormEditGmailAccount::apply() {
   account<GmailServiceRoot>()->network()->setBatchSize(m_details->m_ui.m_spinLimitMessages->value());
   account<GmailServiceRoot>()->network()->setDownloadOnlyUnreadMessages(m_details->m_ui.m_cbDownloadOnlyUnreadMessages
                                                                           ->isChecked());
+  account<GmailServiceRoot>()->network()->setLazyMessageBodies(m_details->m_ui.m_cbLazyMessageBodies->isChecked());
 
   account<GmailServiceRoot>()->saveAccountDataToDatabase();
   accept();
@@ -65,4 +66,5 @@ void FormEditGmailAccount::loadAccountData() {
   m_details->m_ui.m_spinLimitMessages->setValue(account<GmailServiceRoot>()->network()->batchSize());
   m_details->m_ui.m_cbDownloadOnlyUnreadMessages
     ->setChecked(account<GmailServiceRoot>()->network()->downloadOnlyUnreadMessages());
+  m_details->m_ui.m_cbLazyMessageBodies->setChecked(account<GmailServiceRoot>()->network()->lazyMessageBodies());
 }
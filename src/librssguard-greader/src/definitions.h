@@ -46,12 +46,21 @@
 #define GREADER_API_ITEM_CONTENTS_BATCH 999
 #define GREADER_GLOBAL_UPDATE_THRES     0.3
 
+// Number of item contents batches downloaded at once.
+#define GREADER_ITEM_CONTENTS_PARALLEL 4
+
+// Item contents batch is repeated this many times when service asks us to slow down.
+#define GREADER_ITEM_CONTENTS_RETRIES  3
+#define GREADER_ITEM_CONTENTS_MAX_WAIT 60 // In seconds.
+
 // The Old Reader.
 #define TOR_SPONSORED_STREAM_ID "tor/sponsored"
-#define TOR_ITEM_CONTENTS_BATCH 9999
+#define TOR_ITEM_CONTENTS_BATCH    9999
+#define TOR_ITEM_CONTENTS_PARALLEL 2
 
 // Inoreader.
-#define INO_ITEM_CONTENTS_BATCH 250
+#define INO_ITEM_CONTENTS_BATCH    250
+#define INO_ITEM_CONTENTS_PARALLEL 2
 
 #define INO_HEADER_APPID  "AppId"
 #define INO_HEADER_APPKEY "AppKey"
@@ -20,6 +20,12 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+#include <atomic>
 
 GreaderNetwork::GreaderNetwork(QObject* parent)
   : QObject(parent), m_root(nullptr), m_service(GreaderServiceRoot::Service::FreshRss), m_username(QString()),
@@ -515,77 +521,158 @@ QStringList GreaderNetwork::itemIds(const QString& stream_id,
 QList<Message> GreaderNetwork::itemContents(ServiceRoot* root,
                                             const QList<QString>& stream_ids,
                                             const QNetworkProxy& proxy) {
-  QString continuation;
-
   if (!ensureLogin(proxy)) {
     throw FeedFetchException(Feed::Status::AuthError, tr("login failed"));
   }
 
-  QList<Message> msgs;
-  QList<QString> my_stream_ids(stream_ids);
+  int batch =
+    (m_service == GreaderServiceRoot::Service::TheOldReader || m_service == GreaderServiceRoot::Service::FreshRss)
+      ? TOR_ITEM_CONTENTS_BATCH
+      : (m_service == GreaderServiceRoot::Service::Inoreader ? INO_ITEM_CONTENTS_BATCH
+                                                             : GREADER_API_ITEM_CONTENTS_BATCH);
+  int parallel = m_service == GreaderServiceRoot::Service::TheOldReader
+                   ? TOR_ITEM_CONTENTS_PARALLEL
+                   : (m_service == GreaderServiceRoot::Service::Inoreader ? INO_ITEM_CONTENTS_PARALLEL
+                                                                          : GREADER_ITEM_CONTENTS_PARALLEL);
+
+  // NOTE: Authentication is resolved here, so that worker threads
+  // do not touch OAuth service.
+  auto auth_header = authHeader();
+  QString token =
+    (m_service == GreaderServiceRoot::Service::Reedah || m_service == GreaderServiceRoot::Service::Miniflux)
+      ? tokenParameter()
+      : QString();
+
+  // Several batches are downloaded at once and each of them is decoded right
+  // in its worker thread while other batches are still being downloaded.
+  QThreadPool pool;
+  QList<QFuture<ItemContentsBatch>> batches;
+  std::atomic_bool failed(false);
+
+  pool.setMaxThreadCount(parallel);
+
+  for (int i = 0; i < stream_ids.size(); i += batch) {
+    QList<QString> batch_ids = stream_ids.mid(i, batch);
+
+    batches.append(QtConcurrent::run(&pool, [=, &failed]() {
+      if (failed) {
+        // Some other batch failed, so whole download fails anyway.
+        return ItemContentsBatch();
+      }
 
-  while (!my_stream_ids.isEmpty()) {
-    int batch =
-      (m_service == GreaderServiceRoot::Service::TheOldReader || m_service == GreaderServiceRoot::Service::FreshRss)
-        ? TOR_ITEM_CONTENTS_BATCH
-        : (m_service == GreaderServiceRoot::Service::Inoreader ? INO_ITEM_CONTENTS_BATCH
-                                                               : GREADER_API_ITEM_CONTENTS_BATCH);
-    QList<QString> batch_ids = my_stream_ids.mid(0, batch);
+      ItemContentsBatch res = itemContentsBatch(root, batch_ids, auth_header, token, proxy);
 
-    my_stream_ids = my_stream_ids.mid(batch);
+      if (res.m_networkError != QNetworkReply::NetworkError::NoError) {
+        failed = true;
+      }
 
-    do {
-      QString full_url = generateFullUrl(Operations::ItemContents);
-      auto timeout = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::UpdateTimeout)).toInt();
+      return res;
+    }));
+  }
 
-      if (!continuation.isEmpty()) {
-        full_url += QSL("&c=%1").arg(continuation);
-      }
+  QList<Message> msgs;
+  ItemContentsBatch failed_batch;
 
-      std::list inp = boolinq::from(batch_ids)
-                        .select([this](const QString& id) {
-                          return QSL("i=%1").arg(m_service == GreaderServiceRoot::Service::TheOldReader
-                                                   ? id
-                                                   : QUrl::toPercentEncoding(id));
-                        })
-                        .toStdList();
-      QStringList inp_s = FROM_STD_LIST(QStringList, inp);
-
-      if (m_service == GreaderServiceRoot::Service::Reedah || m_service == GreaderServiceRoot::Service::Miniflux) {
-        inp_s.append(tokenParameter());
-      }
+  // Batches are merged in their original order.
+  for (QFuture<ItemContentsBatch>& fut : batches) {
+    ItemContentsBatch res = fut.result();
 
-      QByteArray input = inp_s.join(QSL("&")).toUtf8();
-      QByteArray output_stream;
-      auto result_stream =
-        NetworkFactory::performNetworkOperation(full_url,
-                                                timeout,
-                                                input,
-                                                output_stream,
-                                                QNetworkAccessManager::Operation::PostOperation,
-                                                {authHeader(),
-                                                 {QSL(HTTP_HEADERS_CONTENT_TYPE).toLocal8Bit(),
-                                                  QSL("application/x-www-form-urlencoded").toLocal8Bit()}},
-                                                false,
-                                                {},
-                                                {},
-                                                proxy);
-
-      if (result_stream.m_networkError != QNetworkReply::NetworkError::NoError) {
-        qCriticalNN << LOGSEC_GREADER << "Cannot download messages for " << batch_ids
-                    << ", network error:" << QUOTE_W_SPACE_DOT(result_stream.m_networkError);
-        throw NetworkException(result_stream.m_networkError, output_stream);
-      }
-      else {
-        msgs.append(decodeStreamContents(root, output_stream, QString(), continuation));
+    if (res.m_networkError != QNetworkReply::NetworkError::NoError) {
+      if (failed_batch.m_networkError == QNetworkReply::NetworkError::NoError) {
+        failed_batch = res;
       }
     }
-    while (!continuation.isEmpty());
+    else {
+      msgs.append(res.m_messages);
+    }
+  }
+
+  if (failed_batch.m_networkError != QNetworkReply::NetworkError::NoError) {
+    throw NetworkException(failed_batch.m_networkError, failed_batch.m_output);
   }
 
   return msgs;
 }
 
+GreaderNetwork::ItemContentsBatch GreaderNetwork::itemContentsBatch(ServiceRoot* root,
+                                                                   const QList<QString>& batch_ids,
+                                                                   const QPair<QByteArray, QByteArray>& auth_header,
+                                                                   const QString& token,
+                                                                   const QNetworkProxy& proxy) {
+  ItemContentsBatch res;
+  QString continuation;
+  int retries = 0;
+  auto timeout = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::UpdateTimeout)).toInt();
+  std::list inp = boolinq::from(batch_ids)
+                    .select([this](const QString& id) {
+                      return QSL("i=%1").arg(m_service == GreaderServiceRoot::Service::TheOldReader
+                                               ? id
+                                               : QUrl::toPercentEncoding(id));
+                    })
+                    .toStdList();
+  QStringList inp_s = FROM_STD_LIST(QStringList, inp);
+
+  if (!token.isEmpty()) {
+    inp_s.append(token);
+  }
+
+  QByteArray input = inp_s.join(QSL("&")).toUtf8();
+
+  while (true) {
+    QString full_url = generateFullUrl(Operations::ItemContents);
+
+    if (!continuation.isEmpty()) {
+      full_url += QSL("&c=%1").arg(continuation);
+    }
+
+    QByteArray output_stream;
+    auto result_stream =
+      NetworkFactory::performNetworkOperation(full_url,
+                                              timeout,
+                                              input,
+                                              output_stream,
+                                              QNetworkAccessManager::Operation::PostOperation,
+                                              {auth_header,
+                                               {QSL(HTTP_HEADERS_CONTENT_TYPE).toLocal8Bit(),
+                                                QSL("application/x-www-form-urlencoded").toLocal8Bit()}},
+                                              false,
+                                              {},
+                                              {},
+                                              proxy);
+
+    if (result_stream.m_httpCode == HTTP_CODE_TOO_MANY_REQUESTS && retries++ < GREADER_ITEM_CONTENTS_RETRIES) {
+      // Service wants us to slow down, we wait and then repeat the same request.
+      int wait_secs = result_stream.m_headers.value(QSL(HTTP_HEADERS_RETRY_AFTER)).toInt();
+
+      wait_secs = std::clamp(wait_secs > 0 ? wait_secs : retries * 5, 1, GREADER_ITEM_CONTENTS_MAX_WAIT);
+
+      qWarningNN << LOGSEC_GREADER << "Service is rate-limiting us, waiting" << NONQUOTE_W_SPACE(wait_secs)
+                 << "seconds before repeating request.";
+
+      QThread::sleep(wait_secs);
+      continue;
+    }
+
+    if (result_stream.m_networkError != QNetworkReply::NetworkError::NoError) {
+      qCriticalNN << LOGSEC_GREADER << "Cannot download messages for " << batch_ids
+                  << ", network error:" << QUOTE_W_SPACE_DOT(result_stream.m_networkError);
+
+      res.m_networkError = result_stream.m_networkError;
+      res.m_output = output_stream;
+      res.m_messages.clear();
+      break;
+    }
+
+    res.m_messages.append(decodeStreamContents(root, output_stream, QString(), continuation));
+
+    if (continuation.isEmpty()) {
+      break;
+    }
+  }
+
+  return res;
+}
+
 QList<Message> GreaderNetwork::streamContents(ServiceRoot* root, const QString& stream_id, const QNetworkProxy& proxy) {
   QString continuation;
 
@@ -115,6 +115,19 @@ class GreaderNetwork : public QObject {
     void onAuthFailed();
 
   private:
+    struct ItemContentsBatch {
+        QList<Message> m_messages;
+        QNetworkReply::NetworkError m_networkError = QNetworkReply::NetworkError::NoError;
+        QByteArray m_output;
+    };
+
+    // Downloads and decodes one batch of item contents, this is called from worker threads.
+    ItemContentsBatch itemContentsBatch(ServiceRoot* root,
+                                        const QList<QString>& batch_ids,
+                                        const QPair<QByteArray, QByteArray>& auth_header,
+                                        const QString& token,
+                                        const QNetworkProxy& proxy);
+
     QPair<QByteArray, QByteArray> authHeader() const;
     QString tokenParameter() const;
 
@@ -9,5 +9,6 @@
 #define NEXTCLOUD_MIN_VERSION          "6.0.5"
 #define NEXTCLOUD_UNLIMITED_BATCH_SIZE -1
 #define NEXTCLOUD_DEFAULT_BATCH_SIZE   100
+#define NEXTCLOUD_TYPE_ALL             3
 
 #endif // NEXTCLOUD_DEFINITIONS_H
@@ -35,6 +35,13 @@ void FormEditNextcloudAccount::apply() {
   account<NextcloudServiceRoot>()
     ->network()
     ->setDownloadOnlyUnreadMessages(m_details->m_ui.m_checkDownloadOnlyUnreadMessages->isChecked());
+  account<NextcloudServiceRoot>()
+    ->network()
+    ->setIncrementalSynchronization(m_details->m_ui.m_checkIncrementalSynchronization->isChecked());
+
+  if (using_another_acc) {
+    account<NextcloudServiceRoot>()->resetLastModified();
+  }
 
   account<NextcloudServiceRoot>()->saveAccountDataToDatabase();
   accept();
@@ -55,6 +62,7 @@ void FormEditNextcloudAccount::loadAccountData() {
   m_details->m_ui.m_txtUrl->lineEdit()->setText(existing_root->network()->url());
   m_details->m_ui.m_checkDownloadOnlyUnreadMessages->setChecked(existing_root->network()->downloadOnlyUnreadMessages());
   m_details->m_ui.m_checkServerSideUpdate->setChecked(existing_root->network()->forceServerSideUpdate());
+  m_details->m_ui.m_checkIncrementalSynchronization->setChecked(existing_root->network()->incrementalSynchronization());
   m_details->m_ui.m_spinLimitMessages->setValue(existing_root->network()->batchSize());
 }
 
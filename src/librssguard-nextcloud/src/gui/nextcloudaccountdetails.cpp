@@ -16,6 +16,12 @@ NextcloudAccountDetails::NextcloudAccountDetails(QWidget* parent) : QWidget(pare
     ->setHelpText(tr("Leaving this option on causes that updates "
                      "of feeds will be probably much slower and may time-out often."),
                   true);
+  m_ui.m_lblIncrementalSynchronizationInformation
+    ->setHelpText(tr("If you select incremental synchronization, then articles of all feeds which were "
+                     "added or changed since last update are downloaded with single request. Articles "
+                     "of each feed are downloaded separately only during very first update or when "
+                     "only some feeds are updated."),
+                  false);
   m_ui.m_txtPassword->lineEdit()->setPlaceholderText(tr("Password for your Nextcloud account"));
   m_ui.m_txtPassword->lineEdit()->setPasswordMode(true);
   m_ui.m_txtUsername->lineEdit()->setPlaceholderText(tr("Username for your Nextcloud account"));
@@ -49,7 +55,8 @@ NextcloudAccountDetails::NextcloudAccountDetails(QWidget* parent) : QWidget(pare
   setTabOrder(m_ui.m_txtUrl->lineEdit(), m_ui.m_checkDownloadOnlyUnreadMessages);
   setTabOrder(m_ui.m_checkDownloadOnlyUnreadMessages, m_ui.m_spinLimitMessages);
   setTabOrder(m_ui.m_spinLimitMessages, m_ui.m_checkServerSideUpdate);
-  setTabOrder(m_ui.m_checkServerSideUpdate, m_ui.m_txtUsername->lineEdit());
+  setTabOrder(m_ui.m_checkServerSideUpdate, m_ui.m_checkIncrementalSynchronization);
+  setTabOrder(m_ui.m_checkIncrementalSynchronization, m_ui.m_txtUsername->lineEdit());
   setTabOrder(m_ui.m_txtUsername->lineEdit(), m_ui.m_txtPassword->lineEdit());
   setTabOrder(m_ui.m_txtPassword->lineEdit(), m_ui.m_btnTestSetup);
 
@@ -20,9 +20,10 @@
 
 NextcloudNetworkFactory::NextcloudNetworkFactory()
   : m_url(QString()), m_fixedUrl(QString()), m_downloadOnlyUnreadMessages(false), m_forceServerSideUpdate(false),
-    m_authUsername(QString()), m_authPassword(QString()), m_batchSize(NEXTCLOUD_DEFAULT_BATCH_SIZE),
-    m_urlUser(QString()), m_urlStatus(QString()), m_urlFolders(QString()), m_urlFeeds(QString()),
-    m_urlMessages(QString()), m_urlFeedsUpdate(QString()), m_urlDeleteFeed(QString()), m_urlRenameFeed(QString()) {}
+    m_incrementalSynchronization(false), m_authUsername(QString()), m_authPassword(QString()),
+    m_batchSize(NEXTCLOUD_DEFAULT_BATCH_SIZE), m_urlUser(QString()), m_urlStatus(QString()), m_urlFolders(QString()),
+    m_urlFeeds(QString()), m_urlMessages(QString()), m_urlUpdatedMessages(QString()), m_urlFeedsUpdate(QString()),
+    m_urlDeleteFeed(QString()), m_urlRenameFeed(QString()) {}
 
 NextcloudNetworkFactory::~NextcloudNetworkFactory() = default;
 
@@ -46,6 +47,7 @@ void NextcloudNetworkFactory::setUrl(const QString& url) {
   m_urlFolders = m_fixedUrl + NEXTCLOUD_API_PATH + "folders";
   m_urlFeeds = m_fixedUrl + NEXTCLOUD_API_PATH + "feeds";
   m_urlMessages = m_fixedUrl + NEXTCLOUD_API_PATH + "items?id=%1&batchSize=%2&type=%3&getRead=%4";
+  m_urlUpdatedMessages = m_fixedUrl + NEXTCLOUD_API_PATH + "items/updated?lastModified=%1&type=%2&id=0";
   m_urlFeedsUpdate = m_fixedUrl + NEXTCLOUD_API_PATH + "feeds/update?userId=%1&feedId=%2";
   m_urlDeleteFeed = m_fixedUrl + NEXTCLOUD_API_PATH + "feeds/%1";
   m_urlRenameFeed = m_fixedUrl + NEXTCLOUD_API_PATH + "feeds/%1/rename";
@@ -325,6 +327,41 @@ NextcloudGetMessagesResponse NextcloudNetworkFactory::getMessages(int feed_id, c
   return msgs_response;
 }
 
+NextcloudGetMessagesResponse NextcloudNetworkFactory::getUpdatedMessages(qint64 last_modified,
+                                                                        const QNetworkProxy& custom_proxy) {
+  // Single request returns changes of all feeds of the account.
+  QString final_url = m_urlUpdatedMessages.arg(QString::number(last_modified), QString::number(NEXTCLOUD_TYPE_ALL));
+  QByteArray result_raw;
+  QList<QPair<QByteArray, QByteArray>> headers;
+
+  headers << QPair<QByteArray, QByteArray>(HTTP_HEADERS_CONTENT_TYPE, NEXTCLOUD_CONTENT_TYPE_JSON);
+  headers << NetworkFactory::generateBasicAuthHeader(NetworkFactory::NetworkAuthentication::Basic,
+                                                     m_authUsername,
+                                                     m_authPassword);
+
+  NetworkResult network_reply =
+    NetworkFactory::performNetworkOperation(final_url,
+                                            qApp->settings()
+                                              ->value(GROUP(Feeds), SETTING(Feeds::UpdateTimeout))
+                                              .toInt(),
+                                            QByteArray(),
+                                            result_raw,
+                                            QNetworkAccessManager::Operation::GetOperation,
+                                            headers,
+                                            false,
+                                            {},
+                                            {},
+                                            custom_proxy);
+  NextcloudGetMessagesResponse msgs_response(network_reply.m_networkError, QString::fromUtf8(result_raw));
+
+  if (network_reply.m_networkError != QNetworkReply::NoError) {
+    qCriticalNN << LOGSEC_NEXTCLOUD << "Obtaining updated messages failed with error"
+                << QUOTE_W_SPACE_DOT(network_reply.m_networkError);
+  }
+
+  return msgs_response;
+}
+
 QNetworkReply::NetworkError NextcloudNetworkFactory::triggerFeedUpdate(int feed_id, const QNetworkProxy& custom_proxy) {
   // Now, we can trigger the update.
   QByteArray raw_output;
@@ -464,6 +501,14 @@ void NextcloudNetworkFactory::setDownloadOnlyUnreadMessages(bool dowload_only_un
   m_downloadOnlyUnreadMessages = dowload_only_unread_messages;
 }
 
+bool NextcloudNetworkFactory::incrementalSynchronization() const {
+  return m_incrementalSynchronization;
+}
+
+void NextcloudNetworkFactory::setIncrementalSynchronization(bool incremental) {
+  m_incrementalSynchronization = incremental;
+}
+
 NextcloudResponse::NextcloudResponse(QNetworkReply::NetworkError response, const QString& raw_content)
   : m_networkError(response), m_rawContent(QJsonDocument::fromJson(raw_content.toUtf8()).object()),
     m_emptyString(raw_content.isEmpty()) {}
@@ -658,3 +703,20 @@ QList<Message> NextcloudGetMessagesResponse::messages() const {
 
   return msgs;
 }
+
+qint64 NextcloudGetMessagesResponse::lastModified() const {
+  qint64 last_modified = 0;
+  auto json_items = m_rawContent[QSL("items")].toArray();
+
+  for (const QJsonValue& message : std::as_const(json_items)) {
+    // Server might send the value as number or as string.
+    last_modified = std::max(last_modified, message.toObject()[QSL("lastModified")].toVariant().toLongLong());
+  }
+
+  if (last_modified <= 0 && !json_items.isEmpty()) {
+    qWarningNN << LOGSEC_NEXTCLOUD << "Cannot determine last modification time from"
+               << NONQUOTE_W_SPACE(json_items.size()) << "articles, incremental synchronization is not possible.";
+  }
+
+  return last_modified;
+}
@@ -34,6 +34,10 @@ class NextcloudGetMessagesResponse : public NextcloudResponse {
     virtual ~NextcloudGetMessagesResponse();
 
     QList<Message> messages() const;
+
+    // Returns newest modification time of returned articles,
+    // this is used as watermark for incremental synchronization.
+    qint64 lastModified() const;
 };
 
 class NextcloudStatusResponse : public NextcloudResponse {
@@ -87,6 +91,9 @@ class NextcloudNetworkFactory {
     bool downloadOnlyUnreadMessages() const;
     void setDownloadOnlyUnreadMessages(bool dowload_only_unread_messages);
 
+    bool incrementalSynchronization() const;
+    void setIncrementalSynchronization(bool incremental);
+
     // Operations.
 
     // Get version info.
@@ -103,6 +110,9 @@ class NextcloudNetworkFactory {
     // Get messages for given feed.
     NextcloudGetMessagesResponse getMessages(int feed_id, const QNetworkProxy& custom_proxy);
 
+    // Get messages of all feeds which were added or changed since given time.
+    NextcloudGetMessagesResponse getUpdatedMessages(qint64 last_modified, const QNetworkProxy& custom_proxy);
+
     // Misc methods.
     QNetworkReply::NetworkError triggerFeedUpdate(int feed_id, const QNetworkProxy& custom_proxy);
 
@@ -120,6 +130,7 @@ class NextcloudNetworkFactory {
     QString m_fixedUrl;
     bool m_downloadOnlyUnreadMessages;
     bool m_forceServerSideUpdate;
+    bool m_incrementalSynchronization;
     QString m_authUsername;
     QString m_authPassword;
     int m_batchSize;
@@ -130,6 +141,7 @@ class NextcloudNetworkFactory {
     QString m_urlFolders;
     QString m_urlFeeds;
     QString m_urlMessages;
+    QString m_urlUpdatedMessages;
     QString m_urlFeedsUpdate;
     QString m_urlDeleteFeed;
     QString m_urlRenameFeed;
@@ -9,13 +9,15 @@
 
 #include <librssguard/database/databasequeries.h>
 #include <librssguard/definitions/definitions.h>
+#include <librssguard/exceptions/applicationexception.h>
 #include <librssguard/exceptions/feedfetchexception.h>
 #include <librssguard/exceptions/networkexception.h>
 #include <librssguard/miscellaneous/application.h>
 #include <librssguard/miscellaneous/textfactory.h>
 
 NextcloudServiceRoot::NextcloudServiceRoot(RootItem* parent)
-  : ServiceRoot(parent), m_network(new NextcloudNetworkFactory()) {
+  : ServiceRoot(parent), m_network(new NextcloudNetworkFactory()), m_lastModified(0), m_pendingLastModified(-1),
+    m_performIncrementalFetching(false) {
   setIcon(NextcloudServiceEntryPoint().icon());
 }
 
@@ -75,6 +77,20 @@ NextcloudNetworkFactory* NextcloudServiceRoot::network() const {
   return m_network;
 }
 
+void NextcloudServiceRoot::resetLastModified() {
+  m_lastModified = 0;
+}
+
+void NextcloudServiceRoot::syncIn() {
+  // Newly added feeds might contain articles older than watermark.
+  if (m_lastModified > 0) {
+    resetLastModified();
+    saveAccountDataToDatabase();
+  }
+
+  ServiceRoot::syncIn();
+}
+
 void NextcloudServiceRoot::saveAllCachedData(bool ignore_errors) {
   auto msg_cache = takeMessageCache();
   QMapIterator<RootItem::ReadStatus, QStringList> i(msg_cache.m_cachedStatesRead);
@@ -144,6 +160,8 @@ QVariantHash NextcloudServiceRoot::customDatabaseData() const {
   data[QSL("force_update")] = m_network->forceServerSideUpdate();
   data[QSL("batch_size")] = m_network->batchSize();
   data[QSL("download_only_unread")] = m_network->downloadOnlyUnreadMessages();
+  data[QSL("incremental_sync")] = m_network->incrementalSynchronization();
+  data[QSL("last_modified")] = m_lastModified;
 
   return data;
 }
@@ -157,6 +175,107 @@ void NextcloudServiceRoot::setCustomDatabaseData(const QVariantHash& data) {
   m_network->setForceServerSideUpdate(data[QSL("force_update")].toBool());
   m_network->setBatchSize(data[QSL("batch_size")].toInt());
   m_network->setDownloadOnlyUnreadMessages(data[QSL("download_only_unread")].toBool());
+  m_network->setIncrementalSynchronization(data[QSL("incremental_sync")].toBool());
+
+  m_lastModified = data[QSL("last_modified")].toLongLong();
+}
+
+void NextcloudServiceRoot::aboutToBeginFeedFetching(const QList<Feed*>& feeds,
+                                                    const QHash<QString, QHash<BagOfMessages, QStringList>>&
+                                                      stated_messages,
+                                                    const QHash<QString, QStringList>& tagged_messages) {
+  Q_UNUSED(stated_messages)
+  Q_UNUSED(tagged_messages)
+
+  QMutexLocker lck(&m_mutexPrefetchedMessages);
+
+  m_prefetchedMessages.clear();
+  m_performIncrementalFetching = false;
+  m_pendingLastModified = -1;
+
+  // Changes of all feeds are obtained at once, therefore
+  // watermark can only be used when all feeds are updated.
+  if (!m_network->incrementalSynchronization() || feeds.size() < getSubTreeFeeds().size()) {
+    return;
+  }
+
+  m_pendingLastModified = m_lastModified;
+
+  if (m_lastModified <= 0) {
+    qDebugNN << LOGSEC_NEXTCLOUD << "There is no watermark yet, performing feed-based contents fetching.";
+    return;
+  }
+
+  if (m_network->forceServerSideUpdate()) {
+    for (Feed* feed : feeds) {
+      m_network->triggerFeedUpdate(feed->customNumericId(), networkProxy());
+    }
+  }
+
+  NextcloudGetMessagesResponse messages = m_network->getUpdatedMessages(m_lastModified, networkProxy());
+
+  if (messages.networkError() != QNetworkReply::NetworkError::NoError) {
+    qWarningNN << LOGSEC_NEXTCLOUD << "Falling back to feed-based contents fetching.";
+
+    m_pendingLastModified = -1;
+    return;
+  }
+
+  QSet<QString> feed_ids;
+  int count = 0;
+
+  for (Feed* feed : feeds) {
+    feed_ids.insert(feed->customId());
+    m_prefetchedMessages.insert(feed->customId(), {});
+  }
+
+  const QList<Message> msgs = messages.messages();
+
+  for (const Message& msg : msgs) {
+    if (!feed_ids.contains(msg.m_feedId) || (msg.m_isRead && m_network->downloadOnlyUnreadMessages())) {
+      continue;
+    }
+
+    m_prefetchedMessages[msg.m_feedId].append(msg);
+    count++;
+  }
+
+  m_pendingLastModified = std::max(m_lastModified, messages.lastModified());
+  m_performIncrementalFetching = true;
+
+  qDebugNN << LOGSEC_NEXTCLOUD << "Performing incremental contents fetching, obtained" << NONQUOTE_W_SPACE(count)
+           << "articles changed since" << QUOTE_W_SPACE_DOT(m_lastModified);
+}
+
+void NextcloudServiceRoot::feedFetchingFinished(const QList<Feed*>& feeds) {
+  QMutexLocker lck(&m_mutexPrefetchedMessages);
+  bool all_stored = m_prefetchedMessages.isEmpty();
+
+  for (Feed* feed : feeds) {
+    if (feed->status() != Feed::Status::Normal && feed->status() != Feed::Status::NewMessages) {
+      all_stored = false;
+    }
+  }
+
+  m_prefetchedMessages.clear();
+  m_performIncrementalFetching = false;
+
+  // Watermark can be moved only when all changed articles are safely stored.
+  if (all_stored && m_pendingLastModified > m_lastModified) {
+    m_lastModified = m_pendingLastModified;
+
+    try {
+      QSqlDatabase database = qApp->database()->driver()->threadSafeConnection(metaObject()->className());
+
+      DatabaseQueries::createOverwriteAccount(database, this);
+    }
+    catch (const ApplicationException& ex) {
+      qCriticalNN << LOGSEC_NEXTCLOUD << "Failed to store watermark of incremental synchronization:"
+                  << QUOTE_W_SPACE_DOT(ex.message());
+    }
+  }
+
+  m_pendingLastModified = -1;
 }
 
 QList<Message> NextcloudServiceRoot::obtainNewMessages(Feed* feed,
@@ -166,12 +285,23 @@ QList<Message> NextcloudServiceRoot::obtainNewMessages(Feed* feed,
   Q_UNUSED(stated_messages)
   Q_UNUSED(tagged_messages)
 
+  if (m_performIncrementalFetching) {
+    QMutexLocker lck(&m_mutexPrefetchedMessages);
+
+    return m_prefetchedMessages.take(feed->customId());
+  }
+
   NextcloudGetMessagesResponse messages = network()->getMessages(feed->customNumericId(), networkProxy());
 
   if (messages.networkError() != QNetworkReply::NetworkError::NoError) {
     throw FeedFetchException(Feed::Status::NetworkError);
   }
-  else {
-    return messages.messages();
+
+  if (m_pendingLastModified >= 0) {
+    QMutexLocker lck(&m_mutexPrefetchedMessages);
+
+    m_pendingLastModified = std::max(m_pendingLastModified, messages.lastModified());
   }
+
+  return messages.messages();
 }
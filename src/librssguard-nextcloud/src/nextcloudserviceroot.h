@@ -6,7 +6,9 @@
 #include <librssguard/services/abstract/cacheforserviceroot.h>
 #include <librssguard/services/abstract/serviceroot.h>
 
+#include <QHash>
 #include <QMap>
+#include <QMutex>
 
 class NextcloudNetworkFactory;
 class Mutex;
@@ -29,12 +31,23 @@ class NextcloudServiceRoot : public ServiceRoot, public CacheForServiceRoot {
     virtual void saveAllCachedData(bool ignore_errors);
     virtual QVariantHash customDatabaseData() const;
     virtual void setCustomDatabaseData(const QVariantHash& data);
+    virtual void aboutToBeginFeedFetching(const QList<Feed*>& feeds,
+                                          const QHash<QString, QHash<BagOfMessages, QStringList>>& stated_messages,
+                                          const QHash<QString, QStringList>& tagged_messages);
+    virtual void feedFetchingFinished(const QList<Feed*>& feeds);
     virtual QList<Message> obtainNewMessages(Feed* feed,
                                              const QHash<ServiceRoot::BagOfMessages, QStringList>& stated_messages,
                                              const QHash<QString, QStringList>& tagged_messages);
 
     NextcloudNetworkFactory* network() const;
 
+    // Forgets watermark of incremental synchronization, next update
+    // then downloads articles of each feed separately.
+    void resetLastModified();
+
+  public slots:
+    virtual void syncIn();
+
   protected:
     virtual RootItem* obtainNewTreeForSyncIn() const;
 
@@ -43,6 +56,16 @@ class NextcloudServiceRoot : public ServiceRoot, public CacheForServiceRoot {
 
   private:
     NextcloudNetworkFactory* m_network;
+
+    // Modification time of newest article which is stored in DB and
+    // modification time of newest article fetched in current update.
+    qint64 m_lastModified;
+    qint64 m_pendingLastModified;
+
+    // Articles of all feeds changed since last update, grouped per feed.
+    bool m_performIncrementalFetching;
+    QHash<QString, QList<Message>> m_prefetchedMessages;
+    QMutex m_mutexPrefetchedMessages;
 };
 
 #endif // NEXTCLOUDSERVICEROOT_H
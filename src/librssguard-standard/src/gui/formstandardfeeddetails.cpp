@@ -123,7 +123,7 @@ void FormStandardFeedDetails::apply() {
     }
 
     std_feed->setCreationDate(QDateTime::currentDateTime());
-    std_feed->setLastEtag({});
+    std_feed->setFetchValidators({});
 
     int new_parent_id;
 
@@ -13,16 +13,8 @@
 
 #include <QTextCodec>
 
-AtomParser::AtomParser(const QString& data) : FeedParser(data) {
-  QString version = m_xml.documentElement().attribute(QSL("version"));
-
-  if (version == QSL("0.3")) {
-    m_atomNamespace = QSL("http://purl.org/atom/ns#");
-  }
-  else {
-    m_atomNamespace = QSL("http://www.w3.org/2005/Atom");
-  }
-}
+AtomParser::AtomParser(const QString& data)
+  : FeedParser(data), m_atomNamespace(QSL("http://www.w3.org/2005/Atom")) {}
 
 AtomParser::~AtomParser() {}
 
@@ -317,17 +309,7 @@ QPair<StandardFeed*, QList<IconLocation>> AtomParser::guessFeed(const QByteArray
 }
 
 QString AtomParser::feedAuthor() const {
-  auto authors = m_xml.documentElement().elementsByTagNameNS(m_atomNamespace, QSL("author"));
-
-  for (int i = 0; i < authors.size(); i++) {
-    QDomNode auth = authors.at(i);
-
-    if (auth.parentNode() == m_xml.documentElement()) {
-      return auth.toElement().elementsByTagNameNS(m_atomNamespace, QSL("name")).at(0).toElement().text();
-    }
-  }
-
-  return {};
+  return m_feedAuthor;
 }
 
 QString AtomParser::xmlMessageAuthor(const QDomElement& msg_element) const {
@@ -349,8 +331,33 @@ QString AtomParser::atomNamespace() const {
   return m_atomNamespace;
 }
 
-QDomNodeList AtomParser::xmlMessageElements() {
-  return m_xml.elementsByTagNameNS(m_atomNamespace, QSL("entry"));
+bool AtomParser::xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const {
+  Q_UNUSED(path)
+
+  return reader.namespaceUri() == m_atomNamespace && reader.name() == QL1S("entry");
+}
+
+bool AtomParser::xmlProcessFeedElement(QXmlStreamReader& reader, const QStringList& path) {
+  if (path.isEmpty()) {
+    // This is root element, it decides which ATOM namespace is used.
+    if (reader.attributes().value(QSL("version")) == QL1S("0.3")) {
+      m_atomNamespace = QSL("http://purl.org/atom/ns#");
+    }
+    else {
+      m_atomNamespace = QSL("http://www.w3.org/2005/Atom");
+    }
+
+    return false;
+  }
+
+  // Feed author is name of first "author" which is direct child of root element.
+  if (m_feedAuthor.isEmpty() && path.size() == 2 && path.at(1) == QL1S("author") &&
+      reader.namespaceUri() == m_atomNamespace && reader.name() == QL1S("name")) {
+    m_feedAuthor = reader.readElementText(QXmlStreamReader::ReadElementTextBehaviour::IncludeChildElements);
+    return true;
+  }
+
+  return false;
 }
 
 QString AtomParser::xmlMessageTitle(const QDomElement& msg_element) const {
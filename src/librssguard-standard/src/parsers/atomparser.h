@@ -21,7 +21,8 @@ class AtomParser : public FeedParser {
                                                                 const QString& content_type) const;
 
   protected:
-    virtual QDomNodeList xmlMessageElements();
+    virtual bool xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const;
+    virtual bool xmlProcessFeedElement(QXmlStreamReader& reader, const QStringList& path);
     virtual QString feedAuthor() const;
 
     virtual QString xmlMessageTitle(const QDomElement& msg_element) const;
@@ -37,6 +38,7 @@ class AtomParser : public FeedParser {
     QString atomNamespace() const;
 
     QString m_atomNamespace;
+    QString m_feedAuthor;
 };
 
 #endif // ATOMPARSER_H
@@ -25,24 +25,40 @@ FeedParser::FeedParser(QString data, DataType is_xml)
 
   if (m_dataType == DataType::Xml) {
     // NOTE: Some XMLs have whitespace before XML declaration, erase it.
+    // XML itself is parsed lazily when reading messages.
     m_data = m_data.trimmed();
+  }
+  else if (m_dataType == DataType::Json) {
+    // NOTE: Callers should pass raw bytes, avoid decoding and encoding the whole document again.
+    m_rawData = m_data.toUtf8();
+    m_data.clear();
 
-    // XML.
-    QString error;
+    parseJson();
+  }
+}
 
-    if (!m_xml.setContent(m_data, true, &error)) {
-      throw FeedFetchException(Feed::Status::ParsingError, QObject::tr("XML problem: %1").arg(error));
-    }
+FeedParser::FeedParser(QByteArray json_data)
+  : m_dataType(DataType::Json), m_rawData(std::move(json_data)),
+    m_mrssNamespace(QSL("http://search.yahoo.com/mrss/")) {
+  if (m_rawData.isEmpty()) {
+    return;
   }
-  else if (m_dataType == DataType::Json) {
-    // JSON.
-    QJsonParseError err;
 
-    m_json = QJsonDocument::fromJson(m_data.toUtf8(), &err);
+  // NOTE: Decoding via QTextCodec strips BOM, do the same here.
+  if (m_rawData.startsWith("\xEF\xBB\xBF")) {
+    m_rawData.remove(0, 3);
+  }
 
-    if (m_json.isNull() && err.error != QJsonParseError::ParseError::NoError) {
-      throw FeedFetchException(Feed::Status::ParsingError, QObject::tr("JSON problem: %1").arg(err.errorString()));
-    }
+  parseJson();
+}
+
+void FeedParser::parseJson() {
+  QJsonParseError err;
+
+  m_json = QJsonDocument::fromJson(m_rawData, &err);
+
+  if (m_json.isNull() && err.error != QJsonParseError::ParseError::NoError) {
+    throw FeedFetchException(Feed::Status::ParsingError, QObject::tr("JSON problem: %1").arg(err.errorString()));
   }
 }
 
@@ -128,7 +144,7 @@ QList<MessageCategory> FeedParser::jsonMessageCategories(const QJsonObject& msg_
   return {};
 }
 
-QString FeedParser::jsonMessageRawContents(const QJsonObject& msg_element) const {
+QString FeedParser::jsonMessageRawContents(const QJsonObject& msg_element, int msg_index) const {
   return {};
 }
 
@@ -173,16 +189,40 @@ QString FeedParser::objMessageRawContents(const QVariant& msg_element) const {
 }
 
 QList<Message> FeedParser::messages() {
-  QString feed_author = feedAuthor();
   QList<Message> messages;
   QDateTime current_time = QDateTime::currentDateTimeUtc();
 
   // Pull out all messages.
   if (m_dataType == DataType::Xml) {
-    QDomNodeList messages_in_xml = xmlMessageElements();
+    QXmlStreamReader reader(m_data);
+    QStringList path;
+
+    while (!reader.atEnd()) {
+      reader.readNext();
 
-    for (int i = 0; i < messages_in_xml.size(); i++) {
-      QDomElement message_item = messages_in_xml.item(i).toElement();
+      if (reader.isEndElement()) {
+        if (!path.isEmpty()) {
+          path.removeLast();
+        }
+
+        continue;
+      }
+
+      if (!reader.isStartElement()) {
+        continue;
+      }
+
+      if (!xmlIsMessageElement(reader, path)) {
+        if (!xmlProcessFeedElement(reader, path)) {
+          path.append(reader.name().toString());
+        }
+
+        continue;
+      }
+
+      // NOTE: Only DOM of single article is held in memory at a time.
+      QDomDocument message_document;
+      QDomElement message_item = xmlReadElement(reader, message_document);
 
       try {
         Message new_message;
@@ -205,6 +245,10 @@ QList<Message> FeedParser::messages() {
         qDebugNN << LOGSEC_CORE << "Problem when extracting XML message: " << ex.message();
       }
     }
+
+    if (reader.hasError()) {
+      throw FeedFetchException(Feed::Status::ParsingError, QObject::tr("XML problem: %1").arg(reader.errorString()));
+    }
   }
   else if (m_dataType == DataType::Json) {
     QJsonArray messages_in_json = jsonMessageElements();
@@ -222,7 +266,7 @@ QList<Message> FeedParser::messages() {
         new_message.m_url = jsonMessageUrl(message_item);
         new_message.m_created = jsonMessageDateCreated(message_item);
         new_message.m_customId = jsonMessageId(message_item);
-        new_message.m_rawContents = jsonMessageRawContents(message_item);
+        new_message.m_rawContents = jsonMessageRawContents(message_item, i);
         new_message.m_enclosures = jsonMessageEnclosures(message_item);
 
         messages.append(new_message);
@@ -257,6 +301,10 @@ QList<Message> FeedParser::messages() {
     }
   }
 
+  // NOTE: Feed author is obtained after articles, because it
+  // might be placed after them in the streamed XML.
+  QString feed_author = feedAuthor();
+
   // Fixup missing data.
   //
   // NOTE: Message must have "title" field, otherwise it is skipped.
@@ -306,6 +354,72 @@ QList<Message> FeedParser::messages() {
   return messages;
 }
 
+QDomElement FeedParser::xmlReadElement(QXmlStreamReader& reader, QDomDocument& document) const {
+  // Reader stands at start of the element. Element is converted to DOM
+  // the same way QDomDocument::setContent() would do it.
+  QDomNode parent = document;
+  int depth = 0;
+
+  do {
+    switch (reader.tokenType()) {
+      case QXmlStreamReader::TokenType::StartElement: {
+        QDomElement elem =
+          document.createElementNS(reader.namespaceUri().toString(), reader.qualifiedName().toString());
+        const QXmlStreamAttributes attributes = reader.attributes();
+
+        for (const QXmlStreamAttribute& attr : attributes) {
+          elem.setAttributeNS(attr.namespaceUri().toString(),
+                              attr.qualifiedName().toString(),
+                              attr.value().toString());
+        }
+
+        parent = parent.appendChild(elem);
+        depth++;
+        break;
+      }
+
+      case QXmlStreamReader::TokenType::EndElement:
+        parent = parent.parentNode();
+        depth--;
+        break;
+
+      case QXmlStreamReader::TokenType::Characters:
+        if (reader.isCDATA()) {
+          parent.appendChild(document.createCDATASection(reader.text().toString()));
+        }
+        else if (!reader.isWhitespace()) {
+          parent.appendChild(document.createTextNode(reader.text().toString()));
+        }
+
+        break;
+
+      case QXmlStreamReader::TokenType::EntityReference:
+        parent.appendChild(document.createEntityReference(reader.name().toString()));
+        break;
+
+      case QXmlStreamReader::TokenType::Comment:
+        parent.appendChild(document.createComment(reader.text().toString()));
+        break;
+
+      case QXmlStreamReader::TokenType::ProcessingInstruction:
+        parent.appendChild(document.createProcessingInstruction(reader.processingInstructionTarget().toString(),
+                                                                reader.processingInstructionData().toString()));
+        break;
+
+      default:
+        break;
+    }
+
+    if (depth == 0) {
+      break;
+    }
+
+    reader.readNext();
+  } while (!reader.atEnd());
+
+  return document.documentElement();
+}
+
 QList<Enclosure> FeedParser::xmlMrssGetEnclosures(const QDomElement& msg_element) const {
   QList<Enclosure> enclosures;
   auto content_list = msg_element.elementsByTagNameNS(m_mrssNamespace, QSL("content"));
@@ -420,8 +534,18 @@ QString FeedParser::feedAuthor() const {
   return QL1S("");
 }
 
-QDomNodeList FeedParser::xmlMessageElements() {
-  return {};
+bool FeedParser::xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const {
+  Q_UNUSED(reader)
+  Q_UNUSED(path)
+
+  return false;
+}
+
+bool FeedParser::xmlProcessFeedElement(QXmlStreamReader& reader, const QStringList& path) {
+  Q_UNUSED(reader)
+  Q_UNUSED(path)
+
+  return false;
 }
 
 QString FeedParser::xmlMessageTitle(const QDomElement& msg_element) const {
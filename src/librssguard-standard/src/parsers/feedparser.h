@@ -13,6 +13,7 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QString>
+#include <QXmlStreamReader>
 
 // Base class for all XML-based feed parsers.
 class FeedParser {
@@ -25,6 +26,9 @@ class FeedParser {
 
     FeedParser();
     explicit FeedParser(QString data, DataType is_xml = DataType::Xml);
+
+    // Parses JSON feed directly from its raw UTF-8 bytes.
+    explicit FeedParser(QByteArray json_data);
     virtual ~FeedParser();
 
     // Returns list of absolute URLs of discovered feeds from provided base URL.
@@ -43,8 +47,13 @@ class FeedParser {
   protected:
     virtual QString feedAuthor() const;
 
-    // XML.
-    virtual QDomNodeList xmlMessageElements();
+    // XML, articles are read one by one from stream of XML tokens.
+    // "path" contains local names of all ancestors of current element.
+    virtual bool xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const;
+
+    // Reads feed-level data from element which is not article, returns
+    // true if element was read whole.
+    virtual bool xmlProcessFeedElement(QXmlStreamReader& reader, const QStringList& path);
     virtual QString xmlMessageTitle(const QDomElement& msg_element) const;
     virtual QString xmlMessageUrl(const QDomElement& msg_element) const;
     virtual QString xmlMessageDescription(const QDomElement& msg_element) const;
@@ -65,7 +74,7 @@ class FeedParser {
     virtual QString jsonMessageId(const QJsonObject& msg_element) const;
     virtual QList<Enclosure> jsonMessageEnclosures(const QJsonObject& msg_element) const;
     virtual QList<MessageCategory> jsonMessageCategories(const QJsonObject& msg_element) const;
-    virtual QString jsonMessageRawContents(const QJsonObject& msg_element) const;
+    virtual QString jsonMessageRawContents(const QJsonObject& msg_element, int msg_index) const;
 
     // Objects.
     virtual QVariantList objMessageElements();
@@ -80,6 +89,7 @@ class FeedParser {
     virtual QString objMessageRawContents(const QVariant& msg_element) const;
 
   protected:
+    QDomElement xmlReadElement(QXmlStreamReader& reader, QDomDocument& document) const;
     QList<Enclosure> xmlMrssGetEnclosures(const QDomElement& msg_element) const;
     QString xmlMrssTextFromPath(const QDomElement& msg_element, const QString& xml_path) const;
     QString xmlRawChild(const QDomElement& container) const;
@@ -88,11 +98,14 @@ class FeedParser {
                                  const QString& xml_path,
                                  bool only_first) const;
 
+  private:
+    void parseJson();
+
   protected:
     DataType m_dataType;
     QString m_data;
+    QByteArray m_rawData;
     QString m_dateTimeFormat;
-    QDomDocument m_xml;
     QJsonDocument m_json;
     QString m_mrssNamespace;
 };
@@ -16,7 +16,7 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 
-JsonParser::JsonParser(const QString& data) : FeedParser(data, DataType::Json) {}
+JsonParser::JsonParser(const QByteArray& data) : FeedParser(data) {}
 
 JsonParser::~JsonParser() {}
 
@@ -171,7 +171,15 @@ QString JsonParser::feedAuthor() const {
 }
 
 QJsonArray JsonParser::jsonMessageElements() {
-  return m_json.object()[QSL("items")].toArray();
+  QJsonArray items = m_json.object()[QSL("items")].toArray();
+
+  m_itemsSlices = itemsSlices(m_rawData);
+
+  if (m_itemsSlices.size() != items.size()) {
+    m_itemsSlices.clear();
+  }
+
+  return items;
 }
 
 QString JsonParser::jsonMessageTitle(const QJsonObject& msg_element) const {
@@ -223,6 +231,102 @@ QList<Enclosure> JsonParser::jsonMessageEnclosures(const QJsonObject& msg_elemen
   return enc;
 }
 
-QString JsonParser::jsonMessageRawContents(const QJsonObject& msg_element) const {
+QString JsonParser::jsonMessageRawContents(const QJsonObject& msg_element, int msg_index) const {
+  if (msg_index >= 0 && msg_index < m_itemsSlices.size()) {
+    // Take the item as it is in the original feed, no need to serialize it again.
+    const QPair<int, int>& slice = m_itemsSlices.at(msg_index);
+
+    return QString::fromUtf8(m_rawData.constData() + slice.first, slice.second);
+  }
+
   return QJsonDocument(msg_element).toJson(QJsonDocument::JsonFormat::Compact);
 }
+
+QList<QPair<int, int>> JsonParser::itemsSlices(const QByteArray& data) {
+  QList<QPair<int, int>> slices;
+  QByteArray last_string;
+  bool in_string = false;
+  bool escaped = false;
+  bool in_items = false;
+  int string_start = -1;
+  int item_start = -1;
+  int depth = 0;
+
+  for (int i = 0; i < data.size(); i++) {
+    const char chr = data.at(i);
+
+    if (in_string) {
+      if (escaped) {
+        escaped = false;
+      }
+      else if (chr == '\\') {
+        escaped = true;
+      }
+      else if (chr == '"') {
+        in_string = false;
+
+        if (depth == 1) {
+          last_string = data.mid(string_start, i - string_start);
+        }
+      }
+
+      continue;
+    }
+
+    switch (chr) {
+      case '"':
+        in_string = true;
+        string_start = i + 1;
+        break;
+
+      case '{':
+      case '[':
+        if (in_items && depth == 2) {
+          if (chr != '{') {
+            // Items are not objects.
+            return {};
+          }
+
+          item_start = i;
+        }
+        else if (!in_items && depth == 1 && chr == '[' && last_string == "items") {
+          in_items = true;
+        }
+
+        depth++;
+        break;
+
+      case '}':
+      case ']':
+        depth--;
+
+        if (in_items && depth == 2 && item_start >= 0) {
+          slices.append({item_start, i - item_start + 1});
+          item_start = -1;
+        }
+        else if (in_items && depth == 1) {
+          return slices;
+        }
+
+        break;
+
+      case ',':
+      case ':':
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n':
+        break;
+
+      default:
+        if (in_items && depth == 2) {
+          // Items are not objects.
+          return {};
+        }
+
+        break;
+    }
+  }
+
+  return {};
+}
@@ -9,7 +9,7 @@
 
 class JsonParser : public FeedParser {
   public:
-    explicit JsonParser(const QString& data);
+    explicit JsonParser(const QByteArray& data);
     virtual ~JsonParser();
 
     virtual QList<StandardFeed*> discoverFeeds(ServiceRoot* root, const QUrl& url, bool greedy) const;
@@ -28,7 +28,15 @@ class JsonParser : public FeedParser {
     virtual QDateTime jsonMessageDateCreated(const QJsonObject& msg_element) ;
     virtual QString jsonMessageId(const QJsonObject& msg_element) const;
     virtual QList<Enclosure> jsonMessageEnclosures(const QJsonObject& msg_element) const;
-    virtual QString jsonMessageRawContents(const QJsonObject& msg_element) const;
+    virtual QString jsonMessageRawContents(const QJsonObject& msg_element, int msg_index) const;
+
+  private:
+    // Returns byte ranges of all items from top-level "items" array
+    // or empty list if the array cannot be located.
+    static QList<QPair<int, int>> itemsSlices(const QByteArray& data);
+
+  private:
+    QList<QPair<int, int>> m_itemsSlices;
 };
 
 #endif // JSONPARSER_H
@@ -227,8 +227,10 @@ QPair<StandardFeed*, QList<IconLocation>> RdfParser::guessFeed(const QByteArray&
   return {feed, icon_possible_locations};
 }
 
-QDomNodeList RdfParser::xmlMessageElements() {
-  return m_xml.elementsByTagNameNS(m_rssNamespace, QSL("item"));
+bool RdfParser::xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const {
+  Q_UNUSED(path)
+
+  return reader.namespaceUri() == m_rssNamespace && reader.name() == QL1S("item");
 }
 
 QString RdfParser::rssNamespace() const {
@@ -27,7 +27,7 @@ class RdfParser : public FeedParser {
     virtual QString xmlMessageId(const QDomElement& msg_element) const;
     virtual QString xmlMessageUrl(const QDomElement& msg_element) const;
     virtual QList<Enclosure> xmlMessageEnclosures(const QDomElement& msg_element) const;
-    virtual QDomNodeList xmlMessageElements();
+    virtual bool xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const;
 
   private:
     QString rdfNamespace() const;
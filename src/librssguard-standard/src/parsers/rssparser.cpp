@@ -245,15 +245,10 @@ QPair<StandardFeed*, QList<IconLocation>> RssParser::guessFeed(const QByteArray&
   return {feed, icon_possible_locations};
 }
 
-QDomNodeList RssParser::xmlMessageElements() {
-  QDomNode channel_elem = m_xml.namedItem(QSL("rss")).namedItem(QSL("channel"));
-
-  if (channel_elem.isNull()) {
-    return QDomNodeList();
-  }
-  else {
-    return channel_elem.toElement().elementsByTagName(QSL("item"));
-  }
+bool RssParser::xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const {
+  // Articles are "item" elements anywhere inside of "rss/channel".
+  return path.size() >= 2 && path.at(0) == QL1S("rss") && path.at(1) == QL1S("channel") &&
+         reader.qualifiedName() == QL1S("item");
 }
 
 QString RssParser::xmlMessageTitle(const QDomElement& msg_element) const {
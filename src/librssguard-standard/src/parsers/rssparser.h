@@ -20,7 +20,7 @@ class RssParser : public FeedParser {
                                                                 const QString& content_type) const;
 
   protected:
-    virtual QDomNodeList xmlMessageElements();
+    virtual bool xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const;
     virtual QString xmlMessageTitle(const QDomElement& msg_element) const;
     virtual QString xmlMessageDescription(const QDomElement& msg_element) const;
     virtual QString xmlMessageAuthor(const QDomElement& msg_element) const;
@@ -237,8 +237,10 @@ QString SitemapParser::sitemapVideoNamespace() const {
   return QSL("http://www.google.com/schemas/sitemap-video/1.1");
 }
 
-QDomNodeList SitemapParser::xmlMessageElements() {
-  return m_xml.elementsByTagNameNS(sitemapNamespace(), QSL("url"));
+bool SitemapParser::xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const {
+  Q_UNUSED(path)
+
+  return reader.namespaceUri() == sitemapNamespace() && reader.name() == QL1S("url");
 }
 
 QString SitemapParser::xmlMessageTitle(const QDomElement& msg_element) const {
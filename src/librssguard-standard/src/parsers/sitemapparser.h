@@ -19,7 +19,7 @@ class SitemapParser : public FeedParser {
     static bool isGzip(const QByteArray& content);
 
   protected:
-    virtual QDomNodeList xmlMessageElements();
+    virtual bool xmlIsMessageElement(const QXmlStreamReader& reader, const QStringList& path) const;
     virtual QString xmlMessageTitle(const QDomElement& msg_element) const;
     virtual QString xmlMessageUrl(const QDomElement& msg_element) const;
     virtual QString xmlMessageDescription(const QDomElement& msg_element) const;
@@ -434,14 +434,6 @@ void StandardFeed::setDateTimeFormat(const QString& dt_format) {
   m_dateTimeFormat = dt_format;
 }
 
-QString StandardFeed::lastEtag() const {
-  return m_lastEtag;
-}
-
-void StandardFeed::setLastEtag(const QString& etag) {
-  m_lastEtag = etag;
-}
-
 StandardFeed::Type StandardFeed::type() const {
   return m_type;
 }
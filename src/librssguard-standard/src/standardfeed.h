@@ -104,9 +104,6 @@ class StandardFeed : public Feed {
                                        bool provide_input,
                                        const QString& input = {});
 
-    QString lastEtag() const;
-    void setLastEtag(const QString& etag);
-
     QString dateTimeFormat() const;
     void setDateTimeFormat(const QString& dt_format);
 
@@ -126,7 +123,6 @@ class StandardFeed : public Feed {
     NetworkFactory::NetworkAuthentication m_protection = NetworkFactory::NetworkAuthentication::NoAuthentication;
     QString m_username;
     QString m_password;
-    QString m_lastEtag;
 };
 
 Q_DECLARE_METATYPE(StandardFeed::SourceType)
@@ -41,6 +41,7 @@
 #endif
 
 #include <QAction>
+#include <QCryptographicHash>
 #include <QSqlTableModel>
 #include <QStack>
 #include <QTextCodec>
@@ -56,7 +57,16 @@ StandardServiceRoot::~StandardServiceRoot() {
 
 void StandardServiceRoot::onDatabaseCleanup() {
   for (Feed* fd : getSubTreeFeeds()) {
-    qobject_cast<StandardFeed*>(fd)->setLastEtag({});
+    fd->setFetchValidators({});
+  }
+
+  QSqlDatabase database = qApp->database()->driver()->connection(metaObject()->className());
+
+  try {
+    DatabaseQueries::clearFeedFetchValidators(database, accountId());
+  }
+  catch (const ApplicationException& ex) {
+    qCriticalNN << LOGSEC_DB << "Failed to clear fetch validators of feeds:" << QUOTE_W_SPACE_DOT(ex.message());
   }
 }
 
@@ -203,6 +213,7 @@ QList<Message> StandardServiceRoot::obtainNewMessages(Feed* feed,
   Q_UNUSED(tagged_messages)
 
   StandardFeed* f = static_cast<StandardFeed*>(feed);
+  Feed::FetchValidators validators = f->fetchValidators();
   QByteArray feed_contents;
   QString formatted_feed_contents;
   int download_timeout = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::UpdateTimeout)).toInt();
@@ -214,10 +225,16 @@ QList<Message> StandardServiceRoot::obtainNewMessages(Feed* feed,
 
     headers << NetworkFactory::generateBasicAuthHeader(f->protection(), f->username(), f->password());
 
-    if (!f->lastEtag().isEmpty()) {
-      headers.append({QSL("If-None-Match").toLocal8Bit(), f->lastEtag().toLocal8Bit()});
+    if (!validators.m_eTag.isEmpty()) {
+      headers.append({QSL("If-None-Match").toLocal8Bit(), validators.m_eTag.toLocal8Bit()});
 
-      qDebugNN << "Using ETag value:" << QUOTE_W_SPACE_DOT(f->lastEtag());
+      qDebugNN << LOGSEC_CORE << "Using ETag value:" << QUOTE_W_SPACE_DOT(validators.m_eTag);
+    }
+
+    if (!validators.m_lastModified.isEmpty()) {
+      headers.append({QSL("If-Modified-Since").toLocal8Bit(), validators.m_lastModified.toLocal8Bit()});
+
+      qDebugNN << LOGSEC_CORE << "Using Last-Modified value:" << QUOTE_W_SPACE_DOT(validators.m_lastModified);
     }
 
     auto network_result = NetworkFactory::performNetworkOperation(feed->source(),
@@ -238,15 +255,30 @@ QList<Message> StandardServiceRoot::obtainNewMessages(Feed* feed,
                                NetworkFactory::networkErrorText(network_result.m_networkError));
     }
     else {
-      f->setLastEtag(network_result.m_headers.value(QSL("etag")));
+      const QString etag = network_result.m_headers.value(QSL("etag"));
+      const QString last_modified = network_result.m_headers.value(QSL("last-modified"));
 
       if (network_result.m_httpCode == HTTP_CODE_NOT_MODIFIED && feed_contents.trimmed().isEmpty()) {
-        // We very likely used "eTag" before and server reports that
-        // content was not modified since.
+        // We used validators from last fetch and server reports that
+        // content was not modified since. Server might send refreshed validators.
         qWarningNN << LOGSEC_CORE << QUOTE_W_SPACE(feed->source())
                    << "reported HTTP/304, meaning that the remote file did not change since last time we checked it.";
+
+        if (!etag.isEmpty()) {
+          validators.m_eTag = etag;
+        }
+
+        if (!last_modified.isEmpty()) {
+          validators.m_lastModified = last_modified;
+        }
+
+        f->setFetchValidators(validators);
+        f->setFetchOutcome(Feed::FetchOutcome::NotModified);
         return {};
       }
+
+      validators.m_eTag = etag;
+      validators.m_lastModified = last_modified;
     }
   }
   else if (f->sourceType() == StandardFeed::SourceType::EmbeddedBrowser) {
@@ -273,6 +305,22 @@ QList<Message> StandardServiceRoot::obtainNewMessages(Feed* feed,
     }
   }
 
+  // Same data would yield same articles, so we skip decoding,
+  // parsing and storing of articles entirely.
+  const QString content_hash =
+    QString::fromLatin1(QCryptographicHash::hash(feed_contents, QCryptographicHash::Algorithm::Sha1).toHex());
+  const bool unchanged = validators.m_contentHash == content_hash;
+
+  validators.m_contentHash = content_hash;
+  f->setFetchValidators(validators);
+
+  if (unchanged) {
+    qDebugNN << LOGSEC_CORE << "Data of feed" << QUOTE_W_SPACE(feed->source())
+             << "are identical to data from last fetch.";
+    f->setFetchOutcome(Feed::FetchOutcome::Unchanged);
+    return {};
+  }
+
   // Sitemap parser supports gzip-encoded data too.
   // We need to decode it here before encoding
   // stuff kicks in.
@@ -310,7 +358,14 @@ QList<Message> StandardServiceRoot::obtainNewMessages(Feed* feed,
   // Encode obtained data for further parsing.
   QTextCodec* codec = QTextCodec::codecForName(f->encoding().toLocal8Bit());
 
-  if (codec == nullptr) {
+  if (f->type() == StandardFeed::Type::Json) {
+    // NOTE: JSON is parsed directly from UTF-8 bytes, only
+    // feeds with other encoding need to be converted.
+    if (codec != nullptr && codec != QTextCodec::codecForName("UTF-8")) {
+      feed_contents = codec->toUnicode(feed_contents).toUtf8();
+    }
+  }
+  else if (codec == nullptr) {
     // No suitable codec for this encoding was found.
     // Use UTF-8.
     formatted_feed_contents = QString::fromUtf8(feed_contents);
@@ -322,32 +377,32 @@ QList<Message> StandardServiceRoot::obtainNewMessages(Feed* feed,
   // Feed data are downloaded and encoded.
   // Parse data and obtain messages.
   QList<Message> messages;
-  FeedParser* parser;
+  QScopedPointer<FeedParser> parser;
 
   switch (f->type()) {
     case StandardFeed::Type::Rss0X:
     case StandardFeed::Type::Rss2X:
-      parser = new RssParser(formatted_feed_contents);
+      parser.reset(new RssParser(formatted_feed_contents));
       break;
 
     case StandardFeed::Type::Rdf:
-      parser = new RdfParser(formatted_feed_contents);
+      parser.reset(new RdfParser(formatted_feed_contents));
       break;
 
     case StandardFeed::Type::Atom10:
-      parser = new AtomParser(formatted_feed_contents);
+      parser.reset(new AtomParser(formatted_feed_contents));
       break;
 
     case StandardFeed::Type::Json:
-      parser = new JsonParser(formatted_feed_contents);
+      parser.reset(new JsonParser(feed_contents));
       break;
 
     case StandardFeed::Type::iCalendar:
-      parser = new IcalParser(formatted_feed_contents);
+      parser.reset(new IcalParser(formatted_feed_contents));
       break;
 
     case StandardFeed::Type::Sitemap:
-      parser = new SitemapParser(formatted_feed_contents);
+      parser.reset(new SitemapParser(formatted_feed_contents));
       break;
 
     default:
@@ -364,8 +419,6 @@ QList<Message> StandardServiceRoot::obtainNewMessages(Feed* feed,
     f->setDateTimeFormat(parser->dateTimeFormat());
   }
 
-  delete parser;
-
   for (Message& mess : messages) {
     mess.m_feedId = feed->customId();
   }
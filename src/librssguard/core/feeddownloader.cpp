@@ -4,6 +4,7 @@
 
 #include "3rd-party/boolinq/boolinq.h"
 #include "core/messagefilter.h"
+#include "core/messagefilterengine.h"
 #include "database/databasequeries.h"
 #include "definitions/definitions.h"
 #include "exceptions/feedfetchexception.h"
@@ -14,14 +15,17 @@
 #include "services/abstract/feed.h"
 #include "services/abstract/labelsnode.h"
 
+#include <QDateTime>
 #include <QDebug>
-#include <QJSEngine>
+#include <QSqlError>
 #include <QString>
 #include <QThread>
+#include <QUrl>
 #include <QtConcurrentMap>
 
 FeedDownloader::FeedDownloader()
-  : QObject(), m_isCacheSynchronizationRunning(false), m_stopCacheSynchronization(false) {
+  : QObject(), m_isCacheSynchronizationRunning(false), m_stopCacheSynchronization(false), m_stopUpdate(false),
+    m_ingestThread(nullptr), m_ingestPending(0), m_stopIngest(false) {
   qRegisterMetaType<FeedDownloadResults>("FeedDownloadResults");
 
   connect(&m_watcherLookup, &QFutureWatcher<FeedUpdateResult>::resultReadyAt, this, [=](int idx) {
@@ -36,6 +40,18 @@ FeedDownloader::FeedDownloader()
 
 FeedDownloader::~FeedDownloader() {
   qDebugNN << LOGSEC_FEEDDOWNLOADER << "Destroying FeedDownloader instance.";
+
+  if (m_ingestThread != nullptr) {
+    {
+      QMutexLocker lck(&m_mutexIngest);
+
+      m_stopIngest = true;
+      m_ingestChanged.wakeAll();
+    }
+
+    m_ingestThread->wait();
+    delete m_ingestThread;
+  }
 }
 
 bool FeedDownloader::isUpdateRunning() const {
@@ -70,6 +86,12 @@ void FeedDownloader::updateFeeds(const QList<Feed*>& feeds) {
   m_erroredAccounts.clear();
   m_results.clear();
   m_feeds.clear();
+  m_hostConnections.clear();
+  m_hostThrottledUntil.clear();
+  m_stopUpdate = false;
+
+  // Each update run starts with fresh state of filter scripts.
+  MessageFilterEngine::resetEngines();
 
   if (feeds.isEmpty()) {
     qWarningNN << LOGSEC_FEEDDOWNLOADER << "No feeds to update in worker thread, aborting update.";
@@ -144,6 +166,20 @@ void FeedDownloader::updateFeeds(const QList<Feed*>& feeds) {
         }
       }
 
+      if (!rt->isSyncable()) {
+        // Feeds of synchronized accounts are fetched from their service which is
+        // handled by the plugin, other feeds are limited per their own host.
+        for (FeedUpdateRequest& fu : m_feeds) {
+          const QUrl source_url(fu.feed->source());
+
+          if (fu.account == rt && (source_url.scheme() == QSL("http") || source_url.scheme() == QSL("https"))) {
+            fu.host = source_url.host().toLower();
+          }
+        }
+      }
+
+      const NetworkTransferStats stats_before = NetworkFactory::threadTransferStats();
+
       try {
         rt->aboutToBeginFeedFetching(fds, per_acc_states, per_acc_tags);
       }
@@ -151,6 +187,19 @@ void FeedDownloader::updateFeeds(const QList<Feed*>& feeds) {
         // Common error showed, all feeds from the root are errored now!
         m_erroredAccounts.insert(rt, ex);
       }
+
+      m_results.appendTransferStats(NetworkFactory::threadTransferStats() - stats_before);
+    }
+
+    m_feeds = interleaveHosts(m_feeds);
+
+    if (m_ingestThread == nullptr) {
+      // Writer thread is kept for whole lifetime of the downloader
+      // because each thread has its own DB connection.
+      m_ingestThread = QThread::create([this]() {
+        ingestArticles();
+      });
+      m_ingestThread->start();
     }
 
     std::function<FeedUpdateResult(const FeedUpdateRequest&)> func =
@@ -175,7 +224,33 @@ FeedUpdateResult FeedDownloader::updateThreadedFeed(const FeedUpdateRequest& fd)
     skipFeedUpdateWithError(fd.account, fd.feed, root_ex);
   }
   else {
-    updateOneFeed(fd.account, fd.feed, fd.stated_messages, fd.tagged_messages);
+    for (int attempt = 0; acquireHost(fd.host); attempt++) {
+      const NetworkTransferStats stats_before = NetworkFactory::threadTransferStats();
+
+      updateOneFeed(fd.account, fd.feed, fd.stated_messages, fd.tagged_messages);
+
+      const NetworkTransferStats stats = NetworkFactory::threadTransferStats() - stats_before;
+      const qint64 now = QDateTime::currentMSecsSinceEpoch();
+      qint64 throttled_until = 0;
+
+      if (stats.m_throttledResponses > 0) {
+        // Server rate-limited us, we respect its "Retry-After" or back off exponentially.
+        const qint64 max_wait = qint64(FEED_DOWNLOADER_THROTTLE_MAX) * 1000;
+        const qint64 backoff = qint64(FEED_DOWNLOADER_THROTTLE_WAIT) * 1000 * (qint64(1) << attempt);
+
+        throttled_until =
+          now + std::min(max_wait, stats.m_throttledUntil > now ? stats.m_throttledUntil - now : backoff);
+      }
+
+      releaseHost(fd.host, throttled_until);
+
+      if (throttled_until <= 0 || attempt >= FEED_DOWNLOADER_THROTTLE_RETRIES) {
+        break;
+      }
+
+      qWarningNN << LOGSEC_FEEDDOWNLOADER << "Feed" << QUOTE_W_SPACE(fd.feed->source()) << "was rate-limited, it will"
+                 << "be fetched again in" << NONQUOTE_W_SPACE((throttled_until - now) / 1000) << "seconds.";
+    }
   }
 
   fd.feed->setLastUpdated(QDateTime::currentDateTimeUtc());
@@ -201,6 +276,13 @@ void FeedDownloader::skipFeedUpdateWithError(ServiceRoot* acc, Feed* feed, const
 void FeedDownloader::stopRunningUpdate() {
   m_stopCacheSynchronization = true;
 
+  {
+    QMutexLocker lck(&m_mutexHosts);
+
+    m_stopUpdate = true;
+    m_hostReleased.wakeAll();
+  }
+
   m_watcherLookup.cancel();
   m_watcherLookup.waitForFinished();
 
@@ -227,12 +309,31 @@ void FeedDownloader::updateOneFeed(ServiceRoot* acc,
            << QUOTE_W_SPACE_DOT(thread_id);
 
   int acc_id = acc->accountId();
+  const Feed::FetchValidators previous_validators = feed->fetchValidators();
+  const NetworkTransferStats stats_before = NetworkFactory::threadTransferStats();
   QElapsedTimer tmr;
   tmr.start();
 
+  feed->setFetchOutcome(Feed::FetchOutcome::Downloaded);
+
   try {
     QSqlDatabase database = qApp->database()->driver()->threadSafeConnection(metaObject()->className());
     QList<Message> msgs = feed->getParentServiceRoot()->obtainNewMessages(feed, stated_messages, tagged_messages);
+    FeedIngestBatch batch;
+
+    batch.feed = feed;
+    batch.account = acc;
+    batch.transfer_stats = NetworkFactory::threadTransferStats() - stats_before;
+    batch.previous_validators = previous_validators;
+
+    if (feed->fetchOutcome() != Feed::FetchOutcome::Downloaded) {
+      // Feed data did not change since last fetch, there is nothing to filter or store.
+      qDebugNN << LOGSEC_FEEDDOWNLOADER << "Data of feed ID" << QUOTE_W_SPACE(feed->customId())
+               << "did not change, operation took" << NONQUOTE_W_SPACE(tmr.nsecsElapsed() / 1000) << "microseconds.";
+
+      enqueueArticles(batch);
+      return;
+    }
 
     qDebugNN << LOGSEC_FEEDDOWNLOADER << "Downloaded" << NONQUOTE_W_SPACE(msgs.size()) << "messages for feed ID"
              << QUOTE_W_SPACE_COMMA(feed->customId()) << "operation took" << NONQUOTE_W_SPACE(tmr.nsecsElapsed() / 1000)
@@ -247,18 +348,18 @@ void FeedDownloader::updateOneFeed(ServiceRoot* acc,
       msg.sanitize(feed, fix_future_datetimes);
     }
 
-    QMutexLocker lck(&m_mutexDb);
-
     if (!feed->messageFilters().isEmpty()) {
       tmr.restart();
 
-      // Perform per-message filtering.
-      QJSEngine filter_engine;
+      // Perform per-message filtering. Engine of this thread is reused
+      // across feeds, so scripts are compiled only once per update run.
+      // NOTE: Filtering runs concurrently, DB mutex is only locked when storing articles.
+      MessageFilterEngine* filter_engine = MessageFilterEngine::forCurrentThread();
 
       // Create JavaScript communication wrapper for the message.
       MessageObject msg_obj(&database, feed, feed->getParentServiceRoot(), true);
 
-      MessageFilter::initializeFilteringEngine(filter_engine, &msg_obj);
+      filter_engine->setMessageObject(&msg_obj);
 
       qDebugNN << LOGSEC_FEEDDOWNLOADER << "Setting up JS evaluation took " << tmr.nsecsElapsed() / 1000
                << " microseconds.";
@@ -292,7 +393,7 @@ void FeedDownloader::updateOneFeed(ServiceRoot* acc,
           tmr.restart();
 
           try {
-            MessageObject::FilteringAction decision = msg_filter->filterMessage(&filter_engine);
+            MessageObject::FilteringAction decision = filter_engine->filterMessage(msg_filter);
 
             qDebugNN << LOGSEC_FEEDDOWNLOADER << "Running filter script, it took " << tmr.nsecsElapsed() / 1000
                      << " microseconds.";
@@ -360,6 +461,8 @@ void FeedDownloader::updateOneFeed(ServiceRoot* acc,
         }
       }
 
+      filter_engine->setMessageObject(nullptr);
+
       if (!read_msgs.isEmpty()) {
         // Now we push new read states to the service.
         if (feed->getParentServiceRoot()->onBeforeSetMessagesRead(feed, read_msgs, RootItem::ReadStatus::Read)) {
@@ -394,34 +497,21 @@ void FeedDownloader::updateOneFeed(ServiceRoot* acc,
     removeDuplicateMessages(msgs);
     removeTooOldMessages(feed, msgs);
 
-    tmr.restart();
-    auto updated_messages = acc->updateMessages(msgs, feed, false, nullptr);
-
-    qDebugNN << LOGSEC_FEEDDOWNLOADER << "Updating messages in DB took" << NONQUOTE_W_SPACE(tmr.nsecsElapsed() / 1000)
-             << "microseconds.";
-
-    if (feed->status() != Feed::Status::NewMessages) {
-      feed->setStatus((!updated_messages.m_all.isEmpty() || !updated_messages.m_unread.isEmpty())
-                        ? Feed::Status::NewMessages
-                        : Feed::Status::Normal);
-    }
-
-    qDebugNN << LOGSEC_FEEDDOWNLOADER << updated_messages.m_unread.size() << " unread messages and"
-             << NONQUOTE_W_SPACE(updated_messages.m_all.size()) "total messages for feed"
-             << QUOTE_W_SPACE(feed->customId()) << "stored in DB.";
-
-    m_results.appendUpdatedFeed(feed, updated_messages.m_unread);
+    batch.messages = msgs;
+    enqueueArticles(batch);
   }
   catch (const FeedFetchException& feed_ex) {
     qCriticalNN << LOGSEC_NETWORK << "Error when fetching feed:" << QUOTE_W_SPACE(feed_ex.feedStatus())
                 << "message:" << QUOTE_W_SPACE_DOT(feed_ex.message());
 
+    feed->setFetchValidators(previous_validators);
     feed->setStatus(feed_ex.feedStatus(), feed_ex.message());
   }
   catch (const ApplicationException& app_ex) {
     qCriticalNN << LOGSEC_NETWORK << "Unknown error when fetching feed:"
                 << "message:" << QUOTE_W_SPACE_DOT(app_ex.message());
 
+    feed->setFetchValidators(previous_validators);
     feed->setStatus(Feed::Status::OtherError, app_ex.message());
   }
 
@@ -433,10 +523,167 @@ void FeedDownloader::updateOneFeed(ServiceRoot* acc,
            << m_watcherLookup.progressValue() + 1 << "/" << m_feeds.size() << " (id of feed is " << feed->id() << ").";
 }
 
+void FeedDownloader::enqueueArticles(const FeedIngestBatch& batch) {
+  QMutexLocker lck(&m_mutexIngest);
+
+  // Queue is bounded, fetching threads wait if writer cannot keep up.
+  while (m_ingestQueue.size() >= FEED_DOWNLOADER_INGEST_QUEUE) {
+    m_ingestChanged.wait(&m_mutexIngest);
+  }
+
+  m_ingestQueue.enqueue(batch);
+  m_ingestPending++;
+  m_ingestChanged.wakeAll();
+}
+
+void FeedDownloader::waitForIngestedArticles() {
+  QMutexLocker lck(&m_mutexIngest);
+
+  while (m_ingestPending > 0) {
+    m_ingestChanged.wait(&m_mutexIngest);
+  }
+}
+
+void FeedDownloader::ingestArticles() {
+  QSqlDatabase database = qApp->database()->driver()->threadSafeConnection(metaObject()->className());
+  QMutexLocker lck(&m_mutexIngest);
+
+  while (true) {
+    while (m_ingestQueue.isEmpty() && !m_stopIngest) {
+      m_ingestChanged.wait(&m_mutexIngest);
+    }
+
+    if (m_ingestQueue.isEmpty()) {
+      break;
+    }
+
+    QList<FeedIngestBatch> batches;
+
+    while (!m_ingestQueue.isEmpty() && batches.size() < FEED_DOWNLOADER_INGEST_BATCH) {
+      batches.append(m_ingestQueue.dequeue());
+    }
+
+    m_ingestChanged.wakeAll();
+    lck.unlock();
+
+    QElapsedTimer tmr;
+
+    tmr.start();
+
+    for (FeedIngestBatch& batch : batches) {
+      storeArticles(database, batch);
+    }
+
+    qDebugNN << LOGSEC_FEEDDOWNLOADER << "Storing articles of" << NONQUOTE_W_SPACE(batches.size())
+             << "feeds took" << NONQUOTE_W_SPACE(tmr.nsecsElapsed() / 1000) << "microseconds.";
+
+    lck.relock();
+    m_ingestPending -= batches.size();
+    m_ingestChanged.wakeAll();
+  }
+}
+
+void FeedDownloader::storeArticles(QSqlDatabase& database, FeedIngestBatch& batch) {
+  Feed* feed = batch.feed;
+  const bool update_feed_list =
+    qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::UpdateFeedListDuringFetching)).toBool();
+
+  // Each feed is committed separately. SQLite runs in shared-cache mode, where
+  // open write transaction makes readers on other connections fail with SQLITE_LOCKED,
+  // so transaction must not span more feeds.
+  const bool in_transaction = database.transaction();
+
+  try {
+    const bool downloaded = feed->fetchOutcome() == Feed::FetchOutcome::Downloaded;
+    QList<Message> updated_unread_msgs;
+
+    if (downloaded) {
+      auto updated_messages = batch.account->updateMessages(batch.messages, feed, false, nullptr);
+
+      if (feed->status() != Feed::Status::NewMessages) {
+        feed->setStatus((!updated_messages.m_all.isEmpty() || !updated_messages.m_unread.isEmpty())
+                          ? Feed::Status::NewMessages
+                          : Feed::Status::Normal);
+      }
+
+      qDebugNN << LOGSEC_FEEDDOWNLOADER << updated_messages.m_unread.size() << " unread messages and"
+               << NONQUOTE_W_SPACE(updated_messages.m_all.size()) "total messages for feed"
+               << QUOTE_W_SPACE(feed->customId()) << "stored in DB.";
+
+      updated_unread_msgs = updated_messages.m_unread;
+    }
+    else {
+      if (feed->status() != Feed::Status::NewMessages) {
+        feed->setStatus(Feed::Status::Normal);
+      }
+    }
+
+    // Validators are stored only after articles are safely in DB, so that
+    // failed update does not make next fetch skip the data.
+    DatabaseQueries::storeFeedFetchValidators(database, feed);
+
+    if (in_transaction && !database.commit()) {
+      throw ApplicationException(database.lastError().text());
+    }
+
+    if (downloaded) {
+      m_results.appendUpdatedFeed(feed, updated_unread_msgs);
+    }
+    else {
+      m_results.appendSkippedFeed(feed);
+    }
+
+    m_results.appendTransferStats(batch.transfer_stats);
+  }
+  catch (const ApplicationException& app_ex) {
+    qCriticalNN << LOGSEC_FEEDDOWNLOADER << "Failed to store articles of feed" << QUOTE_W_SPACE(feed->customId())
+                << "message:" << QUOTE_W_SPACE_DOT(app_ex.message());
+
+    // Validators were not stored, so DB still has the previous ones and next fetch
+    // downloads the articles again.
+    if (in_transaction && !database.rollback()) {
+      qCriticalNN << LOGSEC_FEEDDOWNLOADER << "Failed to roll back articles of feed"
+                  << QUOTE_W_SPACE_DOT(feed->customId());
+    }
+
+    feed->setFetchValidators(batch.previous_validators);
+    feed->setStatus(Feed::Status::OtherError, app_ex.message());
+  }
+
+  if (update_feed_list) {
+    batch.account->itemChanged({feed});
+  }
+}
+
 void FeedDownloader::finalizeUpdate() {
   qDebugNN << LOGSEC_FEEDDOWNLOADER << "Finished feed updates in thread"
            << QUOTE_W_SPACE_DOT(QThread::currentThreadId());
 
+  // All articles must be in DB before we report results.
+  waitForIngestedArticles();
+
+  QMultiHash<ServiceRoot*, Feed*> feeds_per_root;
+
+  for (const FeedUpdateRequest& fd : std::as_const(m_feeds)) {
+    m_results.appendFetchedFeed(fd.feed);
+    feeds_per_root.insert(fd.account, fd.feed);
+  }
+
+  const auto roots = feeds_per_root.uniqueKeys();
+
+  for (auto* rt : roots) {
+    rt->feedFetchingFinished(feeds_per_root.values(rt));
+  }
+
+  qDebugNN << LOGSEC_FEEDDOWNLOADER << "Fetched" << NONQUOTE_W_SPACE(m_results.fetchedFeeds().size()) << "feeds,"
+           << NONQUOTE_W_SPACE(m_results.notModifiedFeeds()) << "were not modified (HTTP/304) and"
+           << NONQUOTE_W_SPACE(m_results.unchangedFeeds()) << "had unchanged data.";
+  qDebugNN << LOGSEC_FEEDDOWNLOADER << "Received" << NONQUOTE_W_SPACE(m_results.transferStats().m_responses)
+           << "responses," << NONQUOTE_W_SPACE(m_results.transferStats().m_compressedResponses)
+           << "of them compressed, with" << NONQUOTE_W_SPACE(m_results.transferStats().m_decodedBytes)
+           << "bytes of decoded data," << NONQUOTE_W_SPACE(m_results.transferStats().m_throttledResponses)
+           << "responses were rate-limited.";
+
   m_feeds.clear();
 
   // Update of feeds has finished.
@@ -446,6 +693,76 @@ void FeedDownloader::finalizeUpdate() {
   emit updateFinished(m_results);
 }
 
+QList<FeedUpdateRequest> FeedDownloader::interleaveHosts(const QList<FeedUpdateRequest>& feeds) const {
+  QStringList hosts;
+  QHash<QString, QList<FeedUpdateRequest>> feeds_per_host;
+
+  for (const FeedUpdateRequest& fd : feeds) {
+    if (!feeds_per_host.contains(fd.host)) {
+      hosts.append(fd.host);
+    }
+
+    feeds_per_host[fd.host].append(fd);
+  }
+
+  QList<FeedUpdateRequest> interleaved;
+
+  interleaved.reserve(feeds.size());
+
+  for (int i = 0; interleaved.size() < feeds.size(); i++) {
+    for (const QString& host : std::as_const(hosts)) {
+      const QList<FeedUpdateRequest>& host_feeds = feeds_per_host[host];
+
+      if (i < host_feeds.size()) {
+        interleaved.append(host_feeds.at(i));
+      }
+    }
+  }
+
+  return interleaved;
+}
+
+bool FeedDownloader::acquireHost(const QString& host) {
+  QMutexLocker lck(&m_mutexHosts);
+
+  while (!m_stopUpdate) {
+    if (host.isEmpty()) {
+      return true;
+    }
+
+    const qint64 wait_msecs = m_hostThrottledUntil.value(host) - QDateTime::currentMSecsSinceEpoch();
+
+    if (wait_msecs > 0) {
+      m_hostReleased.wait(&m_mutexHosts, static_cast<unsigned long>(wait_msecs));
+    }
+    else if (m_hostConnections.value(host) < FEED_DOWNLOADER_HOST_CONNECTIONS) {
+      m_hostConnections[host]++;
+      return true;
+    }
+    else {
+      m_hostReleased.wait(&m_mutexHosts);
+    }
+  }
+
+  return false;
+}
+
+void FeedDownloader::releaseHost(const QString& host, qint64 throttled_until) {
+  if (host.isEmpty()) {
+    return;
+  }
+
+  QMutexLocker lck(&m_mutexHosts);
+
+  m_hostConnections[host]--;
+
+  if (throttled_until > m_hostThrottledUntil.value(host)) {
+    m_hostThrottledUntil.insert(host, throttled_until);
+  }
+
+  m_hostReleased.wakeAll();
+}
+
 bool FeedDownloader::isCacheSynchronizationRunning() const {
   return m_isCacheSynchronizationRunning;
 }
@@ -583,10 +900,53 @@ void FeedDownloadResults::appendUpdatedFeed(Feed* feed, const QList<Message>& up
   }
 }
 
+void FeedDownloadResults::appendFetchedFeed(Feed* feed) {
+  m_fetchedFeeds.append(feed);
+}
+
+void FeedDownloadResults::appendSkippedFeed(Feed* feed) {
+  switch (feed->fetchOutcome()) {
+    case Feed::FetchOutcome::NotModified:
+      m_notModifiedFeeds++;
+      break;
+
+    case Feed::FetchOutcome::Unchanged:
+      m_unchangedFeeds++;
+      break;
+
+    default:
+      break;
+  }
+}
+
+void FeedDownloadResults::appendTransferStats(const NetworkTransferStats& stats) {
+  m_transferStats += stats;
+}
+
 void FeedDownloadResults::clear() {
   m_updatedFeeds.clear();
+  m_fetchedFeeds.clear();
+  m_notModifiedFeeds = 0;
+  m_unchangedFeeds = 0;
+  m_transferStats = {};
 }
 
 QHash<Feed*, QList<Message>> FeedDownloadResults::updatedFeeds() const {
   return m_updatedFeeds;
 }
+
+QList<Feed*> FeedDownloadResults::fetchedFeeds() const {
+  return m_fetchedFeeds;
+}
+
+int FeedDownloadResults::notModifiedFeeds() const {
+  return m_notModifiedFeeds;
+}
+
+int FeedDownloadResults::unchangedFeeds() const {
+  return m_unchangedFeeds;
+}
+
+NetworkTransferStats FeedDownloadResults::transferStats() const {
+  return m_transferStats;
+}
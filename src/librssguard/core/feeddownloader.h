@@ -5,6 +5,7 @@
 
 #include "core/message.h"
 #include "exceptions/applicationexception.h"
+#include "network-web/networkfactory.h"
 #include "services/abstract/cacheforserviceroot.h"
 #include "services/abstract/feed.h"
 
@@ -12,25 +13,56 @@
 #include <QHash>
 #include <QObject>
 #include <QPair>
+#include <QQueue>
+#include <QWaitCondition>
+
+#include <atomic>
+
+#define FEED_DOWNLOADER_HOST_CONNECTIONS 2  // Feeds of one host fetched at the same time.
+#define FEED_DOWNLOADER_THROTTLE_RETRIES 2  // Repeated fetches of rate-limited feed.
+#define FEED_DOWNLOADER_THROTTLE_WAIT    5  // In seconds, doubled with each retry.
+#define FEED_DOWNLOADER_THROTTLE_MAX     60 // In seconds.
+#define FEED_DOWNLOADER_INGEST_QUEUE     16 // Feeds with articles waiting to be stored.
+#define FEED_DOWNLOADER_INGEST_BATCH     8  // Feeds taken from queue by writer at once.
 
 class MessageFilter;
+class QThread;
 
 // Represents results of batch feed updates.
 class FeedDownloadResults {
   public:
     QHash<Feed*, QList<Message>> updatedFeeds() const;
+    QList<Feed*> fetchedFeeds() const;
+    int notModifiedFeeds() const;
+    int unchangedFeeds() const;
+    NetworkTransferStats transferStats() const;
     QString overview(int how_many_feeds) const;
     void appendUpdatedFeed(Feed* feed, const QList<Message>& updated_unread_msgs);
+    void appendFetchedFeed(Feed* feed);
+    void appendSkippedFeed(Feed* feed);
+    void appendTransferStats(const NetworkTransferStats& stats);
     void clear();
 
   private:
     // QString represents title if the feed, int represents count of newly downloaded messages.
     QHash<Feed*, QList<Message>> m_updatedFeeds;
+
+    // All feeds which were fetched, even those without new articles or with errors.
+    QList<Feed*> m_fetchedFeeds;
+
+    // Counts of feeds whose data were not processed because they did not change.
+    int m_notModifiedFeeds = 0;
+    int m_unchangedFeeds = 0;
+
+    NetworkTransferStats m_transferStats;
 };
 
 struct FeedUpdateRequest {
     Feed* feed = nullptr;
     ServiceRoot* account = nullptr;
+
+    // Host feed data are downloaded from, empty if fetching of the feed is not limited.
+    QString host;
     QHash<ServiceRoot::BagOfMessages, QStringList> stated_messages;
     QHash<QString, QStringList> tagged_messages;
 };
@@ -39,6 +71,15 @@ struct FeedUpdateResult {
     Feed* feed = nullptr;
 };
 
+// Fetched and filtered articles of one feed waiting to be stored in DB.
+struct FeedIngestBatch {
+    Feed* feed = nullptr;
+    ServiceRoot* account = nullptr;
+    QList<Message> messages;
+    NetworkTransferStats transfer_stats;
+    Feed::FetchValidators previous_validators;
+};
+
 // This class offers means to "update" feeds and "special" categories.
 // NOTE: This class is used within separate thread.
 class FeedDownloader : public QObject {
@@ -72,12 +113,36 @@ class FeedDownloader : public QObject {
     void removeDuplicateMessages(QList<Message>& messages);
     void removeTooOldMessages(Feed* feed, QList<Message>& msgs);
 
+    // Orders feeds so that consecutive feeds are from different hosts.
+    QList<FeedUpdateRequest> interleaveHosts(const QList<FeedUpdateRequest>& feeds) const;
+
+    // Waits until feed from the host can be fetched, returns false if update was stopped.
+    bool acquireHost(const QString& host);
+    void releaseHost(const QString& host, qint64 throttled_until);
+
     FeedUpdateResult updateThreadedFeed(const FeedUpdateRequest& fd);
 
+    // Articles are stored in DB by single writer thread while
+    // other threads keep fetching and filtering other feeds.
+    void enqueueArticles(const FeedIngestBatch& batch);
+    void waitForIngestedArticles();
+    void ingestArticles();
+    void storeArticles(QSqlDatabase& database, FeedIngestBatch& batch);
+
   private:
     bool m_isCacheSynchronizationRunning;
     bool m_stopCacheSynchronization;
-    QMutex m_mutexDb;
+    QMutex m_mutexHosts;
+    QWaitCondition m_hostReleased;
+    QHash<QString, int> m_hostConnections;
+    QHash<QString, qint64> m_hostThrottledUntil;
+    std::atomic_bool m_stopUpdate;
+    QThread* m_ingestThread;
+    QMutex m_mutexIngest;
+    QWaitCondition m_ingestChanged;
+    QQueue<FeedIngestBatch> m_ingestQueue;
+    int m_ingestPending;
+    bool m_stopIngest;
     QHash<ServiceRoot*, ApplicationException> m_erroredAccounts;
     QList<FeedUpdateRequest> m_feeds = {};
     QFutureWatcher<FeedUpdateResult> m_watcherLookup;
@@ -16,8 +16,11 @@
 #include "services/abstract/serviceentrypoint.h"
 #include "services/abstract/serviceroot.h"
 
+#include <QElapsedTimer>
+#include <QHash>
 #include <QMimeData>
 #include <QPair>
+#include <QSet>
 #include <QSqlError>
 #include <QStack>
 #include <QTimer>
@@ -244,37 +247,6 @@ QList<ServiceRoot*> FeedsModel::serviceRoots() const {
   return roots;
 }
 
-QList<Feed*> FeedsModel::feedsForScheduledUpdate(bool auto_update_now) {
-  QList<Feed*> feeds_for_update;
-  auto stf = m_rootItem->getSubTreeFeeds();
-  auto cur_date = QDateTime::currentDateTimeUtc();
-
-  for (Feed* feed : std::as_const(stf)) {
-    switch (feed->autoUpdateType()) {
-      case Feed::AutoUpdateType::DontAutoUpdate:
-        // Do not auto-update this feed ever.
-        continue;
-
-      case Feed::AutoUpdateType::DefaultAutoUpdate:
-        if (auto_update_now) {
-          feeds_for_update.append(feed);
-        }
-
-        break;
-
-      case Feed::AutoUpdateType::SpecificAutoUpdate:
-      default:
-        if (feed->lastUpdated().addSecs(feed->autoUpdateInterval()) < cur_date) {
-          feeds_for_update.append(feed);
-        }
-
-        break;
-    }
-  }
-
-  return feeds_for_update;
-}
-
 int FeedsModel::columnCount(const QModelIndex& parent) const {
   Q_UNUSED(parent)
   return FEEDS_VIEW_COLUMN_COUNT;
@@ -334,23 +306,47 @@ void FeedsModel::setupBehaviorDuringFetching() {
   }
 }
 
-void FeedsModel::reloadChangedLayout(QModelIndexList list) {
-  while (!list.isEmpty()) {
-    QModelIndex indx = list.takeFirst();
+void FeedsModel::reloadChangedItems(const QList<RootItem*>& items) {
+  // Changed items and their ancestors are grouped by their parents first, so that
+  // each parent emits just one signal for range of its changed children.
+  QHash<RootItem*, QPair<int, int>> changed_rows;
+  QSet<RootItem*> visited;
 
-    if (indx.isValid()) {
-      QModelIndex indx_parent = indx.parent();
+  for (RootItem* item : items) {
+    while (item != nullptr && item->kind() != RootItem::Kind::Root && !visited.contains(item)) {
+      RootItem* parent = item->parent();
 
-      // Underlying data are changed.
-      emit dataChanged(index(indx.row(), 0, indx_parent), index(indx.row(), FDS_MODEL_COUNTS_INDEX, indx_parent));
+      if (parent == nullptr) {
+        break;
+      }
 
-      list.append(indx_parent);
+      const int row = item->row();
+      auto rows = changed_rows.find(parent);
+
+      if (rows == changed_rows.end()) {
+        changed_rows.insert(parent, {row, row});
+      }
+      else {
+        rows->first = std::min(rows->first, row);
+        rows->second = std::max(rows->second, row);
+      }
+
+      visited.insert(item);
+      item = parent;
     }
   }
+
+  for (auto i = changed_rows.constBegin(); i != changed_rows.constEnd(); i++) {
+    QModelIndex parent_index = indexForItem(i.key());
+
+    // Underlying data are changed.
+    emit dataChanged(index(i.value().first, 0, parent_index),
+                     index(i.value().second, FDS_MODEL_COUNTS_INDEX, parent_index));
+  }
 }
 
 void FeedsModel::reloadChangedItem(RootItem* item) {
-  reloadChangedLayout({indexForItem(item)});
+  reloadChangedItems({item});
 }
 
 void FeedsModel::notifyWithCounts() {
@@ -358,20 +354,10 @@ void FeedsModel::notifyWithCounts() {
 }
 
 void FeedsModel::onItemDataChanged(const QList<RootItem*>& items) {
-  if (items.size() > RELOAD_MODEL_BORDER_NUM) {
-    qDebugNN << LOGSEC_FEEDMODEL << "There is request to reload feed model for more than " << RELOAD_MODEL_BORDER_NUM
-             << " items, reloading model fully.";
-    reloadWholeLayout();
-  }
-  else {
-    qDebugNN << LOGSEC_FEEDMODEL << "There is request to reload feed model, reloading the " << items.size()
-             << " items individually.";
-
-    for (RootItem* item : items) {
-      reloadChangedItem(item);
-    }
-  }
+  qDebugNN << LOGSEC_FEEDMODEL << "There is request to reload feed model, reloading the " << items.size()
+           << " items and their parents.";
 
+  reloadChangedItems(items);
   notifyWithCounts();
 }
 
@@ -483,6 +469,9 @@ void FeedsModel::sortDirectDescendants(RootItem* item, RootItem::Kind kind_to_so
 
 void FeedsModel::loadActivatedServiceAccounts() {
   auto serv = qApp->feedReader()->feedServices();
+  QElapsedTimer tmr;
+
+  tmr.start();
 
   // Iterate all globally available feed "service plugins".
   for (const ServiceEntryPoint* entry_point : std::as_const(serv)) {
@@ -494,6 +483,8 @@ void FeedsModel::loadActivatedServiceAccounts() {
     }
   }
 
+  qDebugNN << LOGSEC_FEEDMODEL << "Loading of accounts took" << NONQUOTE_W_SPACE(tmr.elapsed()) << "miliseconds.";
+
   if (serviceRoots().isEmpty()) {
     QTimer::singleShot(2000, qApp->mainForm(), []() {
       qApp->mainForm()->showAddAccountDialog();
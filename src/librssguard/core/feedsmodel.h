@@ -45,15 +45,6 @@ class RSSGUARD_DLLSPEC FeedsModel : public QAbstractItemModel {
     // the model root item.
     QList<ServiceRoot*> serviceRoots() const;
 
-    // Returns the list of feeds which should be updated
-    // according to auto-update schedule.
-    // Variable "auto_update_now" is true, when global timeout
-    // for scheduled auto-update was met and global auto-update strategy is enabled
-    // so feeds with "default" auto-update strategy should be updated.
-    //
-    // This method might change some properties of some feeds.
-    QList<Feed*> feedsForScheduledUpdate(bool auto_update_now);
-
     // Returns ALL RECURSIVE CHILD feeds contained within single index.
     QList<Feed*> feedsForIndex(const QModelIndex& index = QModelIndex()) const;
 
@@ -118,8 +109,8 @@ class RSSGUARD_DLLSPEC FeedsModel : public QAbstractItemModel {
 
     // Signals that SOME data of this model need
     // to be reloaded by ALL attached views.
-    // NOTE: This reloads all parent valid indexes too.
-    void reloadChangedLayout(QModelIndexList list);
+    // NOTE: This reloads all parent items too, each of them only once.
+    void reloadChangedItems(const QList<RootItem*>& items);
 
     // Invalidates data under index for the item.
     void reloadChangedItem(RootItem* item);
@@ -0,0 +1,113 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#include "core/feedupdatescheduler.h"
+
+#include "definitions/definitions.h"
+#include "services/abstract/serviceroot.h"
+
+void FeedUpdateScheduler::invalidate() {
+  m_valid = false;
+}
+
+bool FeedUpdateScheduler::isValid() const {
+  return m_valid;
+}
+
+void FeedUpdateScheduler::rebuild(const QList<Feed*>& feeds,
+                                  const QDateTime& global_start,
+                                  int global_interval,
+                                  bool global_enabled) {
+  m_queue.clear();
+  m_dueTimes.clear();
+
+  for (Feed* feed : feeds) {
+    if (feed->isSwitchedOff()) {
+      continue;
+    }
+
+    QDateTime due;
+
+    switch (feed->autoUpdateType()) {
+      case Feed::AutoUpdateType::DontAutoUpdate:
+        continue;
+
+      case Feed::AutoUpdateType::DefaultAutoUpdate:
+        if (!global_enabled) {
+          continue;
+        }
+
+        // Feeds which were not fetched yet are fetched after first global interval.
+        due = qMax(feed->lastUpdated(), global_start).addSecs(global_interval + jitter(feed, global_interval));
+        break;
+
+      case Feed::AutoUpdateType::SpecificAutoUpdate:
+      default:
+        if (feed->lastUpdated().isValid()) {
+          due = feed->lastUpdated().addSecs(feed->autoUpdateInterval() + jitter(feed, feed->autoUpdateInterval()));
+        }
+        else {
+          due = QDateTime::currentDateTimeUtc();
+        }
+
+        break;
+    }
+
+    m_queue.insert(due, feed);
+    m_dueTimes.insert(feed, due);
+  }
+
+  m_valid = true;
+
+  qDebugNN << LOGSEC_CORE << "Auto-fetching schedule contains" << QUOTE_W_SPACE(m_queue.size())
+           << "feeds, next auto-fetch is at" << QUOTE_W_SPACE_DOT(nextDue());
+}
+
+QDateTime FeedUpdateScheduler::nextDue() const {
+  return m_queue.isEmpty() ? QDateTime() : m_queue.firstKey();
+}
+
+QDateTime FeedUpdateScheduler::nextDue(const Feed* feed) const {
+  return m_dueTimes.value(feed);
+}
+
+QList<Feed*> FeedUpdateScheduler::takeDueFeeds(const QDateTime& now) {
+  QList<Feed*> feeds;
+
+  while (!m_queue.isEmpty() && m_queue.firstKey() <= now) {
+    auto it = m_queue.begin();
+    QPointer<Feed> feed = it.value();
+
+    m_queue.erase(it);
+
+    if (!feed.isNull()) {
+      m_dueTimes.remove(feed.data());
+      feeds.append(feed.data());
+    }
+  }
+
+  return feeds;
+}
+
+QList<QPair<QDateTime, Feed*>> FeedUpdateScheduler::upcoming(int count, const ServiceRoot* account) const {
+  QList<QPair<QDateTime, Feed*>> result;
+
+  for (auto it = m_queue.cbegin(); it != m_queue.cend() && result.size() < count; it++) {
+    if (!it.value().isNull() && (account == nullptr || it.value()->getParentServiceRoot() == account)) {
+      result.append({it.key(), it.value().data()});
+    }
+  }
+
+  return result;
+}
+
+int FeedUpdateScheduler::jitter(const Feed* feed, int interval) {
+  const int max_jitter = qMin(AUTO_UPDATE_MAX_JITTER, interval / 10);
+
+  if (max_jitter <= 0) {
+    return 0;
+  }
+
+  // NOTE: Jitter must stay same for the feed, otherwise its schedule
+  // would move each time the schedule is rebuilt.
+  return int(qHash(feed->customId()) % uint(max_jitter + 1));
+}
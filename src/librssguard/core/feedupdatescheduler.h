@@ -0,0 +1,45 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#ifndef FEEDUPDATESCHEDULER_H
+#define FEEDUPDATESCHEDULER_H
+
+#include "services/abstract/feed.h"
+
+#include <QDateTime>
+#include <QHash>
+#include <QMultiMap>
+#include <QPointer>
+
+#define AUTO_UPDATE_MAX_JITTER 300 // In seconds.
+
+// Keeps auto-fetched feeds ordered by time of their next auto-fetch,
+// so that due feeds can be picked without walking whole feed tree.
+class RSSGUARD_DLLSPEC FeedUpdateScheduler {
+  public:
+    // Marks schedule as outdated, it is rebuilt once needed.
+    void invalidate();
+    bool isValid() const;
+
+    void rebuild(const QList<Feed*>& feeds, const QDateTime& global_start, int global_interval, bool global_enabled);
+
+    // Returns time of next auto-fetch or invalid date if no feed is scheduled.
+    QDateTime nextDue() const;
+    QDateTime nextDue(const Feed* feed) const;
+
+    // Removes and returns all feeds which are due at given time.
+    QList<Feed*> takeDueFeeds(const QDateTime& now);
+
+    // Returns first few scheduled feeds, optionally only from given account.
+    QList<QPair<QDateTime, Feed*>> upcoming(int count, const ServiceRoot* account = nullptr) const;
+
+  private:
+    // Feeds with same interval are spread a bit so that they do not fire all at once.
+    static int jitter(const Feed* feed, int interval);
+
+  private:
+    QMultiMap<QDateTime, QPointer<Feed>> m_queue;
+    QHash<const Feed*, QDateTime> m_dueTimes;
+    bool m_valid = false;
+};
+
+#endif // FEEDUPDATESCHEDULER_H
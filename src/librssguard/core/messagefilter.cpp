@@ -6,7 +6,8 @@
 #include "exceptions/filteringexception.h"
 #include "miscellaneous/application.h"
 
-MessageFilter::MessageFilter(int id, QObject* parent) : QObject(parent), m_id(id) {}
+MessageFilter::MessageFilter(int id, QObject* parent)
+  : QObject(parent), m_id(id), m_executionsCount(0), m_executionTime(0) {}
 
 MessageObject::FilteringAction MessageFilter::filterMessage(QJSEngine* engine) {
   QJSValue filter_func = engine->evaluate(qApp->replaceUserDataFolderPlaceholder(m_script));
@@ -50,6 +51,19 @@ void MessageFilter::setScript(const QString& script) {
   m_script = script;
 }
 
+void MessageFilter::addExecutionTime(qint64 microseconds) {
+  m_executionsCount.fetch_add(1, std::memory_order_relaxed);
+  m_executionTime.fetch_add(microseconds, std::memory_order_relaxed);
+}
+
+qint64 MessageFilter::executionsCount() const {
+  return m_executionsCount.load(std::memory_order_relaxed);
+}
+
+qint64 MessageFilter::executionTime() const {
+  return m_executionTime.load(std::memory_order_relaxed);
+}
+
 void MessageFilter::initializeFilteringEngine(QJSEngine& engine, MessageObject* message_wrapper) {
   engine.installExtensions(QJSEngine::Extension::AllExtensions);
   engine.globalObject().setProperty(QSL("MSG_ACCEPT"), int(MessageObject::FilteringAction::Accept));
@@ -57,10 +71,9 @@ void MessageFilter::initializeFilteringEngine(QJSEngine& engine, MessageObject*
   engine.globalObject().setProperty(QSL("MSG_PURGE"), int(MessageObject::FilteringAction::Purge));
 
   // Register the wrapper.
-  auto js_object = engine.newQObject(message_wrapper);
   auto js_meta_object = engine.newQMetaObject(&MessageObject::staticMetaObject);
 
-  engine.globalObject().setProperty(QSL("msg"), js_object);
+  setMessageObject(engine, message_wrapper);
   engine.globalObject().setProperty(MessageObject::staticMetaObject.className(), js_meta_object);
 
   // Register "utils".
@@ -70,6 +83,17 @@ void MessageFilter::initializeFilteringEngine(QJSEngine& engine, MessageObject*
   engine.globalObject().setProperty(QSL("utils"), js_utils);
 }
 
+void MessageFilter::setMessageObject(QJSEngine& engine, MessageObject* message_wrapper) {
+  if (message_wrapper == nullptr) {
+    engine.globalObject().setProperty(QSL("msg"), QJSValue(QJSValue::SpecialValue::NullValue));
+    return;
+  }
+
+  // Wrapper is owned by caller, JS garbage collector must not delete it.
+  QJSEngine::setObjectOwnership(message_wrapper, QJSEngine::ObjectOwnership::CppOwnership);
+  engine.globalObject().setProperty(QSL("msg"), engine.newQObject(message_wrapper));
+}
+
 void MessageFilter::setId(int id) {
   m_id = id;
 }
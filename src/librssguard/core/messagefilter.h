@@ -9,6 +9,8 @@
 #include <QJSEngine>
 #include <QObject>
 
+#include <atomic>
+
 // Class which represents one message filter.
 class RSSGUARD_DLLSPEC MessageFilter : public QObject {
     Q_OBJECT
@@ -27,12 +29,21 @@ class RSSGUARD_DLLSPEC MessageFilter : public QObject {
     QString script() const;
     void setScript(const QString& script);
 
+    // Statistics of filter runs during feed fetching, time is in microseconds.
+    // NOTE: These are updated concurrently from worker threads.
+    void addExecutionTime(qint64 microseconds);
+    qint64 executionsCount() const;
+    qint64 executionTime() const;
+
     static void initializeFilteringEngine(QJSEngine& engine, MessageObject* message_wrapper);
+    static void setMessageObject(QJSEngine& engine, MessageObject* message_wrapper);
 
   private:
     int m_id;
     QString m_name;
     QString m_script;
+    std::atomic<qint64> m_executionsCount;
+    std::atomic<qint64> m_executionTime;
 };
 
 #endif // MESSAGEFILTER_H
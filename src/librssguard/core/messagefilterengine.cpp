@@ -0,0 +1,88 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#include "core/messagefilterengine.h"
+
+#include "core/messagefilter.h"
+#include "exceptions/filteringexception.h"
+#include "miscellaneous/application.h"
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <QThreadStorage>
+
+#include <atomic>
+
+static std::atomic_int& enginesGeneration() {
+  static std::atomic_int generation(0);
+  return generation;
+}
+
+MessageFilterEngine::MessageFilterEngine(int generation) : m_generation(generation) {
+  MessageFilter::initializeFilteringEngine(m_engine, nullptr);
+}
+
+MessageFilterEngine* MessageFilterEngine::forCurrentThread() {
+  static QThreadStorage<MessageFilterEngine*> engines;
+  const int generation = enginesGeneration().load();
+
+  if (!engines.hasLocalData() || engines.localData()->m_generation != generation) {
+    qDebugNN << LOGSEC_CORE << "Creating article filtering engine for thread"
+             << QUOTE_W_SPACE_DOT(QThread::currentThreadId());
+
+    // NOTE: Previous engine of this thread is deleted.
+    engines.setLocalData(new MessageFilterEngine(generation));
+  }
+
+  return engines.localData();
+}
+
+void MessageFilterEngine::resetEngines() {
+  enginesGeneration()++;
+}
+
+void MessageFilterEngine::setMessageObject(MessageObject* message_wrapper) {
+  MessageFilter::setMessageObject(m_engine, message_wrapper);
+}
+
+MessageObject::FilteringAction MessageFilterEngine::filterMessage(MessageFilter* filter) {
+  QJSValue filter_func = compiledFilter(filter);
+  QElapsedTimer tmr;
+
+  tmr.start();
+
+  QJSValue filter_output = filter_func.call();
+
+  filter->addExecutionTime(tmr.nsecsElapsed() / 1000);
+
+  if (filter_output.isError()) {
+    throw FilteringException(filter_output.errorType(), filter_output.toString());
+  }
+
+  return MessageObject::FilteringAction(filter_output.toInt());
+}
+
+QJSValue MessageFilterEngine::compiledFilter(MessageFilter* filter) {
+  const QString script = qApp->replaceUserDataFolderPlaceholder(filter->script());
+  auto compiled = m_compiledFilters.constFind(filter->id());
+
+  if (compiled != m_compiledFilters.constEnd() && compiled->m_script == script) {
+    return compiled->m_function;
+  }
+
+  // Script is evaluated only once, its "filterMessage" function
+  // is then called directly for each article.
+  QJSValue filter_func = m_engine.evaluate(QSL("(function() {\n%1\nreturn filterMessage;\n})();").arg(script));
+
+  if (filter_func.isError()) {
+    throw FilteringException(filter_func.errorType(), filter_func.toString());
+  }
+
+  if (!filter_func.isCallable()) {
+    throw FilteringException(QJSValue::ErrorType::TypeError,
+                             QSL("script of filter '%1' does not define filterMessage() function")
+                               .arg(filter->name()));
+  }
+
+  m_compiledFilters.insert(filter->id(), {script, filter_func});
+  return filter_func;
+}
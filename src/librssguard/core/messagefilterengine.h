@@ -0,0 +1,49 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#ifndef MESSAGEFILTERENGINE_H
+#define MESSAGEFILTERENGINE_H
+
+#include "core/messageobject.h"
+
+#include <QHash>
+#include <QJSEngine>
+#include <QJSValue>
+
+class MessageFilter;
+
+// Pre-initialized JS engine which keeps filter scripts compiled between
+// feeds of one update run. QJSEngine can only be used in thread which created it,
+// therefore each thread has its own engine.
+class RSSGUARD_DLLSPEC MessageFilterEngine {
+  public:
+    // Returns engine of the calling thread, engine is created on first use
+    // and re-created on first use after engines were reset.
+    static MessageFilterEngine* forCurrentThread();
+
+    // Makes all threads discard their engines, so that top-level state of
+    // scripts does not survive into next update run and compiled scripts of
+    // deleted filters are freed.
+    static void resetEngines();
+
+    // Exposes given article wrapper as "msg" to filter scripts.
+    void setMessageObject(MessageObject* message_wrapper);
+
+    MessageObject::FilteringAction filterMessage(MessageFilter* filter);
+
+  private:
+    explicit MessageFilterEngine(int generation);
+
+    QJSValue compiledFilter(MessageFilter* filter);
+
+  private:
+    struct CompiledFilter {
+        QString m_script;
+        QJSValue m_function;
+    };
+
+    int m_generation;
+    QJSEngine m_engine;
+    QHash<int, CompiledFilter> m_compiledFilters;
+};
+
+#endif // MESSAGEFILTERENGINE_H
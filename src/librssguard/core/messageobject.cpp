@@ -9,6 +9,7 @@
 #include "definitions/globals.h"
 #include "services/abstract/labelsnode.h"
 
+#include <QJSEngine>
 #include <QRandomGenerator>
 #include <QSqlDatabase>
 #include <QSqlError>
@@ -105,14 +106,24 @@ bool MessageObject::isDuplicateWithAttribute(MessageObject::DuplicateCheck attri
       return true;
     }
   }
-  else if (q.lastError().isValid()) {
+  else {
     qWarningNN << LOGSEC_CORE << "Error when checking for duplicate messages via filtering system, error:"
                << QUOTE_W_SPACE_DOT(q.lastError().text());
+
+    throwScriptError(QSL("cannot check for duplicate articles: %1").arg(q.lastError().text()));
   }
 
   return false;
 }
 
+void MessageObject::throwScriptError(const QString& error) const {
+  QJSEngine* engine = qjsEngine(this);
+
+  if (engine != nullptr) {
+    engine->throwError(error);
+  }
+}
+
 bool MessageObject::assignLabel(const QString& label_custom_id) const {
   // NOTE: This is now not needed as the underlying bug was fixed in DB layer.
   /*
@@ -200,6 +211,7 @@ QString MessageObject::createLabelId(const QString& title, const QString& hex_co
   }
   catch (const ApplicationException& ex) {
     qCriticalNN << LOGSEC_CORE << "Cannot create label:" << QUOTE_W_SPACE_DOT(ex.message());
+    throwScriptError(QSL("cannot create label: %1").arg(ex.message()));
 
     if (new_lbl != nullptr) {
       new_lbl->deleteLater();
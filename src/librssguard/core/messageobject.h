@@ -150,6 +150,11 @@ class MessageObject : public QObject {
     double score() const;
     void setScore(double score);
 
+  private:
+    // Makes running filter script fail with given error, so that failed
+    // DB operation is not mistaken for regular result.
+    void throwScriptError(const QString& error) const;
+
   private:
     QSqlDatabase* m_db;
 
@@ -29,7 +29,12 @@ MessagesModel::MessagesModel(QObject* parent)
     m_messageHighlighter(MessageHighlighter::NoHighlighting), m_customDateFormat(QString()),
     m_customTimeFormat(QString()), m_customFormatForDatesOnly(QString()), m_newerArticlesRelativeTime(-1),
     m_selectedItem(nullptr), m_unreadIconType(MessageUnreadIcon::Dot),
-    m_multilineListItems(qApp->settings()->value(GROUP(Messages), SETTING(Messages::MultilineArticleList)).toBool()) {
+    m_multilineListItems(qApp->settings()->value(GROUP(Messages), SETTING(Messages::MultilineArticleList)).toBool()),
+    m_windowedArticleList(qApp->settings()->value(GROUP(Messages), SETTING(Messages::WindowedArticleList)).toBool()) {
+  if (m_windowedArticleList) {
+    setContentsPrefixLength(MSG_LIST_CONTENTS_PREFIX);
+  }
+
   updateFeedIconsDisplay();
   updateDateFormat();
 
@@ -142,9 +147,16 @@ MessagesModelCache* MessagesModel::cache() const {
   return m_cache;
 }
 
+bool MessagesModel::windowedArticleList() const {
+  return m_windowedArticleList;
+}
+
 void MessagesModel::repopulate(int additional_article_id) {
   m_cache->clear();
 
+  // When reloading the same list, keep at least as many rows as were
+  // loaded before, so that selected article can be found again.
+  const int window_rows = std::max(rowCount(), MSG_LIST_WINDOW_ROWS);
   QString statemnt = selectStatement(additional_article_id);
 
   setQuery(statemnt, m_db);
@@ -155,13 +167,27 @@ void MessagesModel::repopulate(int additional_article_id) {
     qCriticalNN << LOGSEC_MESSAGEMODEL << "Used SQL select statement:" << QUOTE_W_SPACE_DOT(statemnt);
   }
 
-  while (canFetchMore()) {
-    fetchMore();
+  if (m_windowedArticleList) {
+    // Remaining rows are fetched by the view once user scrolls to the end of the list.
+    // NOTE: Until then, the query stays active and holds read lock of the database,
+    // which is why windowed list is opt-in.
+    while (rowCount() < window_rows && canFetchMore()) {
+      fetchMore();
+    }
+  }
+  else {
+    fetchAllData();
   }
 
   qDebugNN << LOGSEC_MESSAGEMODEL << "Repopulated model, SQL statement is now:\n" << QUOTE_W_SPACE_DOT(statemnt);
 }
 
+void MessagesModel::fetchAllData() {
+  while (canFetchMore()) {
+    fetchMore();
+  }
+}
+
 bool MessagesModel::setData(const QModelIndex& idx, const QVariant& value, int role) {
   Q_UNUSED(role)
   m_cache->setData(idx, value);
@@ -194,6 +220,9 @@ void MessagesModel::setupFonts() {
 void MessagesModel::loadMessages(RootItem* item) {
   m_selectedItem = item;
 
+  // Rows of previously loaded item must not enlarge the window of new item.
+  clear();
+
   if (item == nullptr) {
     setFilter(QSL(DEFAULT_SQL_MESSAGES_FILTER));
   }
@@ -284,8 +313,15 @@ void MessagesModel::reloadWholeLayout() {
   emit layoutChanged();
 }
 
-Message MessagesModel::messageAt(int row_index) const {
-  return Message::fromSqlRecord(m_cache->containsData(row_index) ? m_cache->record(row_index) : record(row_index));
+Message MessagesModel::messageAt(int row_index, bool load_contents) const {
+  Message msg =
+    Message::fromSqlRecord(m_cache->containsData(row_index) ? m_cache->record(row_index) : record(row_index));
+
+  if (load_contents && contentsPrefixLength() > 0 && msg.m_id > 0) {
+    msg.m_contents = DatabaseQueries::getArticlesContents(m_db, {msg.m_id}).value(msg.m_id);
+  }
+
+  return msg;
 }
 
 void MessagesModel::setupHeaderData() {
@@ -331,10 +367,22 @@ Qt::ItemFlags MessagesModel::flags(const QModelIndex& index) const {
 
 QList<Message> MessagesModel::messagesAt(const QList<int>& row_indices) const {
   QList<Message> msgs;
+  QList<int> ids;
+
   msgs.reserve(row_indices.size());
+  ids.reserve(row_indices.size());
 
   for (int idx : row_indices) {
-    msgs << messageAt(idx);
+    msgs << messageAt(idx, false);
+    ids << msgs.last().m_id;
+  }
+
+  if (contentsPrefixLength() > 0 && !ids.isEmpty()) {
+    const QHash<int, QString> contents = DatabaseQueries::getArticlesContents(m_db, ids);
+
+    for (Message& msg : msgs) {
+      msg.m_contents = contents.value(msg.m_id);
+    }
   }
 
   return msgs;
@@ -626,7 +674,7 @@ bool MessagesModel::setMessageRead(int row_index, RootItem::ReadStatus read) {
     return true;
   }
 
-  Message message = messageAt(row_index);
+  Message message = messageAt(row_index, false);
 
   if (!m_selectedItem->getParentServiceRoot()->onBeforeSetMessagesRead(m_selectedItem, {message}, read)) {
     // Cannot change read status of the item. Abort.
@@ -695,7 +743,7 @@ bool MessagesModel::switchMessageImportance(int row_index) {
   const RootItem::Importance next_importance = current_importance == RootItem::Importance::Important
                                                  ? RootItem::Importance::NotImportant
                                                  : RootItem::Importance::Important;
-  const Message message = messageAt(row_index);
+  const Message message = messageAt(row_index, false);
   const QPair<Message, RootItem::Importance> pair(message, next_importance);
 
   if (!m_selectedItem->getParentServiceRoot()
@@ -734,7 +782,7 @@ bool MessagesModel::switchBatchMessageImportance(const QModelIndexList& messages
 
   // Obtain IDs of all desired messages.
   for (const QModelIndex& message : messages) {
-    const Message msg = messageAt(message.row());
+    const Message msg = messageAt(message.row(), false);
 
     RootItem::Importance message_importance = messageImportance((message.row()));
 
@@ -772,7 +820,7 @@ bool MessagesModel::setBatchMessagesDeleted(const QModelIndexList& messages) {
 
   // Obtain IDs of all desired messages.
   for (const QModelIndex& message : messages) {
-    const Message msg = messageAt(message.row());
+    const Message msg = messageAt(message.row(), false);
 
     msgs.append(msg);
     message_ids.append(QString::number(msg.m_id));
@@ -816,7 +864,7 @@ bool MessagesModel::setBatchMessagesRead(const QModelIndexList& messages, RootIt
 
   // Obtain IDs of all desired messages.
   for (const QModelIndex& message : messages) {
-    Message msg = messageAt(message.row());
+    Message msg = messageAt(message.row(), false);
 
     msgs.append(msg);
     message_ids.append(QString::number(msg.m_id));
@@ -845,7 +893,7 @@ bool MessagesModel::setBatchMessagesRestored(const QModelIndexList& messages) {
 
   // Obtain IDs of all desired messages.
   for (const QModelIndex& message : messages) {
-    const Message msg = messageAt(message.row());
+    const Message msg = messageAt(message.row(), false);
 
     msgs.append(msg);
     message_ids.append(QString::number(msg.m_id));
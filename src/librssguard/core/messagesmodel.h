@@ -39,10 +39,14 @@ class MessagesModel : public QSqlQueryModel, public MessagesModelSqlLayer {
     explicit MessagesModel(QObject* parent = nullptr);
     virtual ~MessagesModel();
 
-    // Fetches ALL available data to the model.
+    // Fetches ALL available data to the model, or only first window of rows
+    // if windowed article list is enabled.
     // NOTE: This activates the SQL query and populates the model with new data.
     void repopulate(int additional_article_id = 0);
 
+    // Fetches all rows which were not fetched yet.
+    void fetchAllData();
+
     // Model implementation.
     bool setData(const QModelIndex& idx, const QVariant& value, int role = Qt::EditRole);
     QVariant data(const QModelIndex& idx, int role = Qt::DisplayRole) const;
@@ -50,13 +54,16 @@ class MessagesModel : public QSqlQueryModel, public MessagesModelSqlLayer {
     QVariant headerData(int section, Qt::Orientation orientation, int role) const;
     Qt::ItemFlags flags(const QModelIndex& index) const;
 
+    // NOTE: Full article contents are loaded from DB on demand if
+    // the model only holds prefix of contents.
     QList<Message> messagesAt(const QList<int>& row_indices) const;
-    Message messageAt(int row_index) const;
+    Message messageAt(int row_index, bool load_contents = true) const;
     int messageId(int row_index) const;
     RootItem::Importance messageImportance(int row_index) const;
 
     RootItem* loadedItem() const;
     MessagesModelCache* cache() const;
+    bool windowedArticleList() const;
 
     void setupFonts();
     void updateDateFormat();
@@ -120,6 +127,7 @@ class MessagesModel : public QSqlQueryModel, public MessagesModelSqlLayer {
     QList<QIcon> m_scoreIcons;
     MessageUnreadIcon m_unreadIconType;
     bool m_multilineListItems;
+    bool m_windowedArticleList;
 };
 
 Q_DECLARE_METATYPE(MessagesModel::MessageHighlighter)
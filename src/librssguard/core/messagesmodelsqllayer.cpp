@@ -8,8 +8,8 @@
 #include "miscellaneous/application.h"
 
 MessagesModelSqlLayer::MessagesModelSqlLayer()
-  : m_filter(QSL(DEFAULT_SQL_MESSAGES_FILTER)), m_fieldNames({}), m_orderByNames({}), m_sortColumns({}),
-    m_numericColumns({}), m_sortOrders({}) {
+  : m_filter(QSL(DEFAULT_SQL_MESSAGES_FILTER)), m_contentsPrefixLength(0), m_fieldNames({}), m_orderByNames({}),
+    m_sortColumns({}), m_numericColumns({}), m_sortOrders({}) {
   m_db = qApp->database()->driver()->connection(QSL("MessagesModel"));
 
   // Used in <x>: SELECT <x1>, <x2> FROM ....;
@@ -36,7 +36,7 @@ MessagesModelSqlLayer::MessagesModelSqlLayer()
   m_orderByNames[MSG_DB_FEED_IS_RTL_INDEX] = QSL("Feeds.is_rtl");
   m_orderByNames[MSG_DB_HAS_ENCLOSURES] = QSL("has_enclosures");
   m_orderByNames[MSG_DB_LABELS] = QSL("msg_labels");
-  m_orderByNames[MSG_DB_LABELS_IDS] = QSL("Messages.labels");
+  m_orderByNames[MSG_DB_LABELS_IDS] = QSL("msg_labels_ids");
 
   m_numericColumns << MSG_DB_ID_INDEX << MSG_DB_READ_INDEX << MSG_DB_DELETED_INDEX << MSG_DB_PDELETED_INDEX
                    << MSG_DB_IMPORTANT_INDEX << MSG_DB_ACCOUNT_ID_INDEX << MSG_DB_DCREATED_INDEX << MSG_DB_SCORE_INDEX
@@ -79,6 +79,24 @@ void MessagesModelSqlLayer::setFilter(const QString& filter) {
   m_filter = filter;
 }
 
+QString MessagesModelSqlLayer::fullTextQuery() const {
+  return m_fullTextQuery;
+}
+
+void MessagesModelSqlLayer::setFullTextQuery(const QString& query) {
+  m_fullTextQuery = query;
+}
+
+int MessagesModelSqlLayer::contentsPrefixLength() const {
+  return m_contentsPrefixLength;
+}
+
+void MessagesModelSqlLayer::setContentsPrefixLength(int length) {
+  m_contentsPrefixLength = length;
+  m_fieldNames[MSG_DB_CONTENTS_INDEX] =
+    length > 0 ? QSL("SUBSTR(Messages.contents, 1, %1)").arg(length) : QSL("Messages.contents");
+}
+
 SortColumnsAndOrders MessagesModelSqlLayer::sortColumnAndOrders() const {
   SortColumnsAndOrders res;
 
@@ -97,13 +115,16 @@ bool MessagesModelSqlLayer::isColumnNumeric(int column_id) const {
 }
 
 QString MessagesModelSqlLayer::selectStatement(int additional_article_id) const {
-  QString fltr;
+  QString fltr = m_filter;
+
+  if (!m_fullTextQuery.isEmpty()) {
+    const QString query = QSL("'%1'").arg(DatabaseFactory::escapeQuery(m_fullTextQuery));
 
-  if (additional_article_id <= 0) {
-    fltr = m_filter;
+    fltr = QSL("(%1) AND %2").arg(fltr, qApp->database()->driver()->fullTextCondition(query));
   }
-  else {
-    fltr = QSL("(%1) OR Messages.id = %2").arg(m_filter, QString::number(additional_article_id));
+
+  if (additional_article_id > 0) {
+    fltr = QSL("(%1) OR Messages.id = %2").arg(fltr, QString::number(additional_article_id));
   }
 
   return QL1S("SELECT ") + formatFields() + QL1C(' ') +
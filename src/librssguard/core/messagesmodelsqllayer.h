@@ -23,6 +23,15 @@ class MessagesModelSqlLayer {
     // Sets SQL WHERE clause, without "WHERE" keyword.
     void setFilter(const QString& filter);
 
+    // Limits articles to those matching full-text query, empty query turns search off.
+    QString fullTextQuery() const;
+    void setFullTextQuery(const QString& query);
+
+    // Makes SELECT load only first "length" characters of article contents,
+    // zero makes it load full contents.
+    int contentsPrefixLength() const;
+    void setContentsPrefixLength(int length);
+
     SortColumnsAndOrders sortColumnAndOrders() const;
 
   protected:
@@ -36,6 +45,8 @@ class MessagesModelSqlLayer {
 
   private:
     QString m_filter;
+    QString m_fullTextQuery;
+    int m_contentsPrefixLength;
 
     // NOTE: These two lists contain data for multicolumn sorting.
     // They are always same length. Most important sort column/order
@@ -138,6 +138,14 @@ QModelIndex MessagesProxyModel::getNextPreviousImportantItemIndex(int default_ro
   const bool started_from_zero = default_row == 0;
   QModelIndex next_index = getNextImportantItemIndex(default_row, rowCount() - 1);
 
+  // Next article might be among articles which are not loaded yet.
+  while (!next_index.isValid() && m_sourceModel->canFetchMore()) {
+    const int loaded_rows = rowCount();
+
+    m_sourceModel->fetchMore();
+    next_index = getNextImportantItemIndex(loaded_rows, rowCount() - 1);
+  }
+
   // There is no next message, check previous.
   if (!next_index.isValid() && !started_from_zero) {
     next_index = getNextImportantItemIndex(0, default_row - 1);
@@ -150,6 +158,14 @@ QModelIndex MessagesProxyModel::getNextPreviousUnreadItemIndex(int default_row)
   const bool started_from_zero = default_row == 0;
   QModelIndex next_index = getNextUnreadItemIndex(default_row, rowCount() - 1);
 
+  // Next article might be among articles which are not loaded yet.
+  while (!next_index.isValid() && m_sourceModel->canFetchMore()) {
+    const int loaded_rows = rowCount();
+
+    m_sourceModel->fetchMore();
+    next_index = getNextUnreadItemIndex(loaded_rows, rowCount() - 1);
+  }
+
   // There is no next message, check previous.
   if (!next_index.isValid() && !started_from_zero) {
     next_index = getNextUnreadItemIndex(0, default_row - 1);
@@ -0,0 +1,129 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#include "core/probeengine.h"
+
+#include "database/databasequeries.h"
+#include "exceptions/applicationexception.h"
+#include "miscellaneous/application.h"
+#include "services/abstract/search.h"
+
+#include <QElapsedTimer>
+#include <QSqlError>
+#include <QThread>
+#include <QThreadStorage>
+
+ProbeEngine* ProbeEngine::forCurrentThread() {
+  static QThreadStorage<ProbeEngine*> engines;
+
+  if (!engines.hasLocalData()) {
+    qDebugNN << LOGSEC_CORE << "Creating probe engine for thread" << QUOTE_W_SPACE_DOT(QThread::currentThreadId());
+
+    engines.setLocalData(new ProbeEngine());
+  }
+
+  return engines.localData();
+}
+
+void ProbeEngine::matchArticles(const QSqlDatabase& db, int account_id, const QList<Message>& messages) {
+  if (messages.isEmpty()) {
+    return;
+  }
+
+  const QHash<int, QString> probes = DatabaseQueries::getRegexProbesForAccount(db, account_id);
+  QList<int> message_ids;
+  QList<QPair<int, int>> hits;
+
+  message_ids.reserve(messages.size());
+
+  for (const Message& msg : messages) {
+    message_ids.append(msg.m_id);
+  }
+
+  // Updated articles might not match their probes anymore.
+  DatabaseQueries::removeProbeHitsOfMessages(db, message_ids);
+
+  if (probes.isEmpty()) {
+    return;
+  }
+
+  QElapsedTimer tmr;
+
+  tmr.start();
+
+  for (auto prb = probes.constBegin(); prb != probes.constEnd(); prb++) {
+    const QRegularExpression& regex = compiledProbe(prb.key(), prb.value());
+
+    if (!regex.isValid()) {
+      continue;
+    }
+
+    for (const Message& msg : messages) {
+      if (regex.match(msg.m_title).hasMatch() || regex.match(msg.m_contents).hasMatch()) {
+        hits.append({prb.key(), msg.m_id});
+      }
+    }
+  }
+
+  DatabaseQueries::storeProbeHits(db, account_id, hits);
+
+  qDebugNN << LOGSEC_CORE << "Matching" << NONQUOTE_W_SPACE(messages.size()) << "articles against"
+           << NONQUOTE_W_SPACE(probes.size()) << "probes took" << NONQUOTE_W_SPACE(tmr.elapsed())
+           << "miliseconds and found" << NONQUOTE_W_SPACE(hits.size()) << "hits.";
+}
+
+void ProbeEngine::matchProbe(const QSqlDatabase& db, const Search* probe, int account_id) {
+  QSqlDatabase database = db;
+
+  if (!database.transaction()) {
+    qWarningNN << LOGSEC_DB << "Failed to start transaction for probe hits:"
+               << QUOTE_W_SPACE_DOT(database.lastError().text());
+  }
+
+  try {
+    DatabaseQueries::removeProbeHits(database, probe->id());
+
+    // Full-text probes are looked up directly in full-text index.
+    if (probe->filterType() == Search::FilterType::RegularExpression) {
+      const QRegularExpression& regex = compiledProbe(probe->id(), probe->filter());
+
+      if (regex.isValid()) {
+        const QList<int> message_ids = DatabaseQueries::getMessagesMatchingRegex(database, account_id, regex);
+        QList<QPair<int, int>> hits;
+
+        hits.reserve(message_ids.size());
+
+        for (int message_id : message_ids) {
+          hits.append({probe->id(), message_id});
+        }
+
+        DatabaseQueries::storeProbeHits(database, account_id, hits);
+      }
+      else {
+        qWarningNN << LOGSEC_CORE << "Probe" << QUOTE_W_SPACE(probe->title())
+                   << "has invalid regular expression:" << QUOTE_W_SPACE_DOT(regex.errorString());
+      }
+    }
+
+    database.commit();
+  }
+  catch (const ApplicationException& ex) {
+    database.rollback();
+
+    qCriticalNN << LOGSEC_CORE << "Failed to match articles of probe" << QUOTE_W_SPACE(probe->title())
+                << "with error:" << QUOTE_W_SPACE_DOT(ex.message());
+  }
+}
+
+const QRegularExpression& ProbeEngine::compiledProbe(int probe_id, const QString& filter) {
+  auto compiled = m_compiledProbes.find(probe_id);
+
+  if (compiled != m_compiledProbes.end() && compiled->pattern() == filter) {
+    return *compiled;
+  }
+
+  // Pattern is JIT-compiled right away, it is then matched against many articles.
+  QRegularExpression regex(filter, QRegularExpression::PatternOption::DontCaptureOption);
+
+  regex.optimize();
+  return *m_compiledProbes.insert(probe_id, regex);
+}
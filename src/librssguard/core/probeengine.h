@@ -0,0 +1,38 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#ifndef PROBEENGINE_H
+#define PROBEENGINE_H
+
+#include "core/message.h"
+
+#include <QHash>
+#include <QRegularExpression>
+#include <QSqlDatabase>
+
+class Search;
+
+// Evaluates regular expression probes of account against articles
+// and remembers their hits, so that probe counts and listings are
+// simple lookups. Patterns are compiled only once per thread.
+class RSSGUARD_DLLSPEC ProbeEngine {
+  public:
+    // Returns engine of the calling thread, engine is created on first use.
+    static ProbeEngine* forCurrentThread();
+
+    // Matches given stored articles against all probes of the account in single pass.
+    void matchArticles(const QSqlDatabase& db, int account_id, const QList<Message>& messages);
+
+    // Matches all articles of the account against given probe, this is needed
+    // when probe is created or its filter is changed.
+    void matchProbe(const QSqlDatabase& db, const Search* probe, int account_id);
+
+  private:
+    explicit ProbeEngine() = default;
+
+    const QRegularExpression& compiledProbe(int probe_id, const QString& filter);
+
+  private:
+    QHash<int, QRegularExpression> m_compiledProbes;
+};
+
+#endif // PROBEENGINE_H
@@ -102,6 +102,7 @@ QStringList DatabaseDriver::prepareScript(const QString& base_sql_folder,
   statements = statements.replaceInStrings(QSL(APP_DB_NAME_PLACEHOLDER), database_name);
   statements = statements.replaceInStrings(QSL(APP_DB_AUTO_INC_PRIM_KEY_PLACEHOLDER), autoIncrementPrimaryKey());
   statements = statements.replaceInStrings(QSL(APP_DB_BLOB_PLACEHOLDER), blob());
+  statements = statements.replaceInStrings(QSL(APP_DB_TEXT_INDEX_PLACEHOLDER), textIndexPrefix());
 
   return statements;
 }
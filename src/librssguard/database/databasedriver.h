@@ -38,6 +38,14 @@ class RSSGUARD_DLLSPEC DatabaseDriver : public QObject {
     virtual DriverType driverType() const = 0;
     virtual QString autoIncrementPrimaryKey() const = 0;
     virtual QString blob() const = 0;
+
+    // Returns key prefix length specifier which must follow
+    // TEXT columns when they are used in index.
+    virtual QString textIndexPrefix() const = 0;
+
+    // Returns SQL condition which matches articles against full-text index,
+    // query is SQL expression, for example bound placeholder or quoted string.
+    virtual QString fullTextCondition(const QString& query) const = 0;
     virtual bool vacuumDatabase() = 0;
     virtual bool saveDatabase() = 0;
     virtual void backupDatabase(const QString& backup_folder, const QString& backup_name) = 0;
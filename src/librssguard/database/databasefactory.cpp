@@ -28,8 +28,14 @@ void DatabaseFactory::removeConnection(const QString& connection_name) {
 }
 
 void DatabaseFactory::determineDriver() {
+  const auto sqlite_profile = SqliteDriver::StorageProfile(
+    qApp->settings()->value(GROUP(Database), SETTING(Database::SqliteStorageProfile)).toInt());
+
   m_allDbDrivers = {
-    new SqliteDriver(qApp->settings()->value(GROUP(Database), SETTING(Database::UseInMemory)).toBool(), this)};
+    new SqliteDriver(qApp->settings()->value(GROUP(Database), SETTING(Database::UseInMemory)).toBool(),
+                     sqlite_profile,
+                     qApp->settings()->value(GROUP(Database), SETTING(Database::SqliteCacheSize)).toInt(),
+                     this)};
 
   if (QSqlDatabase::isDriverAvailable(QSL(APP_DB_MYSQL_DRIVER))) {
     m_allDbDrivers.append(new MariaDbDriver(this));
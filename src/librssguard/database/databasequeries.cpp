@@ -10,6 +10,8 @@
 #include "miscellaneous/settings.h"
 #include "services/abstract/category.h"
 
+#include <algorithm>
+
 #include <QSqlDriver>
 #include <QUrl>
 #include <QVariant>
@@ -40,27 +42,25 @@ QMap<int, QString> DatabaseQueries::messageTableAttributes(bool only_msg_table,
                                            "ELSE 'false' "
                                            "END AS has_enclosures");
 
+  // Labels of each article are looked up via index on LabelsInMessages/message.
+  field_names[MSG_DB_LABELS] =
+    QSL("(SELECT GROUP_CONCAT(Labels.name) FROM LabelsInMessages "
+        "INNER JOIN Labels ON Labels.account_id = LabelsInMessages.account_id AND "
+        "Labels.custom_id = LabelsInMessages.label "
+        "WHERE LabelsInMessages.message = Messages.id) as msg_labels");
+
+  // Label IDs are returned in ".<id1>.<id2>." format.
   if (is_sqlite) {
-    field_names[MSG_DB_LABELS] =
-      QSL("(SELECT GROUP_CONCAT(Labels.name) FROM Labels WHERE Messages.labels LIKE \"%.\" || "
-          "Labels.custom_id || \".%\") as msg_labels");
+    field_names[MSG_DB_LABELS_IDS] =
+      QSL("(SELECT '.' || GROUP_CONCAT(LabelsInMessages.label, '.') || '.' FROM LabelsInMessages "
+          "WHERE LabelsInMessages.message = Messages.id) as msg_labels_ids");
   }
   else {
-    field_names[MSG_DB_LABELS] =
-      QSL("(SELECT GROUP_CONCAT(Labels.name) FROM Labels WHERE Messages.labels LIKE CONCAT(\"%.\", "
-          "Labels.custom_id, \".%\")) as msg_labels");
+    field_names[MSG_DB_LABELS_IDS] =
+      QSL("(SELECT CONCAT('.', GROUP_CONCAT(LabelsInMessages.label SEPARATOR '.'), '.') FROM LabelsInMessages "
+          "WHERE LabelsInMessages.message = Messages.id) as msg_labels_ids");
   }
 
-  field_names[MSG_DB_LABELS_IDS] = QSL("Messages.labels");
-
-  // TODO: zpomaluje zobrazení seznamu zpráv
-  /*
-  field_names[MSG_DB_LABELS] =
-    QSL("(SELECT GROUP_CONCAT(Labels.name) FROM Labels WHERE Labels.custom_id IN (SELECT "
-        "LabelsInMessages.label FROM LabelsInMessages WHERE LabelsInMessages.account_id = "
-        "Messages.account_id AND LabelsInMessages.message = Messages.custom_id)) as msg_labels");
-        */
-
   return field_names;
 }
 
@@ -88,12 +88,14 @@ bool DatabaseQueries::isLabelAssignedToMessage(const QSqlDatabase& db, Label* la
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-  q.prepare(QSL("SELECT COUNT(*) FROM Messages "
+  q.prepare(QSL("SELECT COUNT(*) FROM LabelsInMessages "
+                "INNER JOIN Messages ON Messages.id = LabelsInMessages.message "
                 "WHERE "
-                "  Messages.labels LIKE :label AND "
+                "  LabelsInMessages.label = :label AND "
+                "  LabelsInMessages.account_id = :account_id AND "
                 "  Messages.custom_id = :message AND "
-                "  account_id = :account_id;"));
-  q.bindValue(QSL(":label"), QSL("%.%1.%").arg(label->customId()));
+                "  Messages.account_id = :account_id;"));
+  q.bindValue(QSL(":label"), label->customId());
   q.bindValue(QSL(":message"), msg.m_customId);
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
 
@@ -106,10 +108,12 @@ bool DatabaseQueries::deassignLabelFromMessage(const QSqlDatabase& db, Label* la
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-  q.prepare(QSL("UPDATE Messages "
-                "SET labels = REPLACE(Messages.labels, :label, \".\") "
-                "WHERE Messages.custom_id = :message AND account_id = :account_id;"));
-  q.bindValue(QSL(":label"), QSL(".%1.").arg(label->customId()));
+  q.prepare(QSL("DELETE FROM LabelsInMessages "
+                "WHERE "
+                "  label = :label AND "
+                "  account_id = :account_id AND "
+                "  message IN (SELECT id FROM Messages WHERE custom_id = :message AND account_id = :account_id);"));
+  q.bindValue(QSL(":label"), label->customId());
   q.bindValue(QSL(":message"), msg.m_customId.isEmpty() ? QString::number(msg.m_id) : msg.m_customId);
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
 
@@ -122,19 +126,10 @@ bool DatabaseQueries::assignLabelToMessage(const QSqlDatabase& db, Label* label,
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-
-  if (db.driverName() == QSL(APP_DB_MYSQL_DRIVER)) {
-    q.prepare(QSL("UPDATE Messages "
-                  "SET labels = CONCAT(Messages.labels, :label) "
-                  "WHERE Messages.custom_id = :message AND account_id = :account_id;"));
-  }
-  else {
-    q.prepare(QSL("UPDATE Messages "
-                  "SET labels = Messages.labels || :label "
-                  "WHERE Messages.custom_id = :message AND account_id = :account_id;"));
-  }
-
-  q.bindValue(QSL(":label"), QSL("%1.").arg(label->customId()));
+  q.prepare(QSL("INSERT INTO LabelsInMessages (label, message, account_id) "
+                "SELECT :label, id, account_id FROM Messages "
+                "WHERE Messages.custom_id = :message AND account_id = :account_id;"));
+  q.bindValue(QSL(":label"), label->customId());
   q.bindValue(QSL(":message"), msg.m_customId.isEmpty() ? QString::number(msg.m_id) : msg.m_customId);
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
 
@@ -143,25 +138,35 @@ bool DatabaseQueries::assignLabelToMessage(const QSqlDatabase& db, Label* label,
 
 bool DatabaseQueries::setLabelsForMessage(const QSqlDatabase& db, const QList<Label*>& labels, const Message& msg) {
   QSqlQuery q(db);
+  const QString msg_custom_id = msg.m_customId.isEmpty() ? QString::number(msg.m_id) : msg.m_customId;
 
-  auto std_lbls = boolinq::from(labels)
-                    .select([](Label* lbl) {
-                      return lbl->customId();
-                    })
-                    .toStdList();
+  q.setForwardOnly(true);
+  q.prepare(QSL("DELETE FROM LabelsInMessages "
+                "WHERE "
+                "  account_id = :account_id AND "
+                "  message IN (SELECT id FROM Messages WHERE custom_id = :message AND account_id = :account_id);"));
+  q.bindValue(QSL(":message"), msg_custom_id);
+  q.bindValue(QSL(":account_id"), msg.m_accountId);
 
-  QStringList lbls = FROM_STD_LIST(QStringList, std_lbls);
-  QString lblss = QSL(".") + lbls.join('.') + QSL(".");
+  if (!q.exec()) {
+    return false;
+  }
 
-  q.setForwardOnly(true);
-  q.prepare(QSL("UPDATE Messages "
-                "SET labels = :labels "
+  q.prepare(QSL("INSERT INTO LabelsInMessages (label, message, account_id) "
+                "SELECT :label, id, account_id FROM Messages "
                 "WHERE Messages.custom_id = :message AND account_id = :account_id;"));
-  q.bindValue(QSL(":labels"), lblss);
-  q.bindValue(QSL(":message"), msg.m_customId.isEmpty() ? QString::number(msg.m_id) : msg.m_customId);
-  q.bindValue(QSL(":account_id"), msg.m_accountId);
 
-  return q.exec();
+  for (const Label* lbl : labels) {
+    q.bindValue(QSL(":label"), lbl->customId());
+    q.bindValue(QSL(":message"), msg_custom_id);
+    q.bindValue(QSL(":account_id"), msg.m_accountId);
+
+    if (!q.exec()) {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 QList<Label*> DatabaseQueries::getLabelsForAccount(const QSqlDatabase& db, int account_id) {
@@ -193,22 +198,18 @@ QList<Label*> DatabaseQueries::getLabelsForMessage(const QSqlDatabase& db,
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-  q.prepare(QSL("SELECT labels FROM Messages WHERE custom_id = :message AND account_id = :account_id;"));
+  q.prepare(QSL("SELECT LabelsInMessages.label FROM LabelsInMessages "
+                "INNER JOIN Messages ON Messages.id = LabelsInMessages.message "
+                "WHERE Messages.custom_id = :message AND Messages.account_id = :account_id;"));
 
   q.bindValue(QSL(":account_id"), msg.m_accountId);
   q.bindValue(QSL(":message"), msg.m_customId.isEmpty() ? QString::number(msg.m_id) : msg.m_customId);
 
-  if (q.exec() && q.next()) {
-    auto label_ids = q.value(0).toString().split('.',
-#if QT_VERSION >= 0x050F00 // Qt >= 5.15.0
-                                                 Qt::SplitBehaviorFlags::SkipEmptyParts);
-#else
-                                                 QString::SplitBehavior::SkipEmptyParts);
-#endif
-
+  if (q.exec()) {
     auto iter = boolinq::from(installed_labels);
 
-    for (const QString& lbl_id : label_ids) {
+    while (q.next()) {
+      const QString lbl_id = q.value(0).toString();
       Label* candidate_label = iter.firstOrDefault([&](const Label* lbl) {
         return lbl->customId() == lbl_id;
       });
@@ -247,10 +248,8 @@ bool DatabaseQueries::deleteLabel(const QSqlDatabase& db, Label* label) {
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
 
   if (q.exec()) {
-    q.prepare(QSL("UPDATE Messages "
-                  "SET labels = REPLACE(Messages.labels, :label, \".\") "
-                  "WHERE account_id = :account_id;"));
-    q.bindValue(QSL(":label"), QSL(".%1.").arg(label->customId()));
+    q.prepare(QSL("DELETE FROM LabelsInMessages WHERE label = :label AND account_id = :account_id;"));
+    q.bindValue(QSL(":label"), label->customId());
     q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
 
     return q.exec();
@@ -289,14 +288,128 @@ bool DatabaseQueries::createLabel(const QSqlDatabase& db, Label* label, int acco
   return q.exec() && res;
 }
 
+QString DatabaseQueries::probeCondition(const Search* probe, const QString& fltr) {
+  if (probe->filterType() == Search::FilterType::FullText) {
+    return qApp->database()->driver()->fullTextCondition(fltr);
+  }
+  else {
+    // Hits of regular expression probes are evaluated when articles are stored.
+    return QSL("Messages.id IN (SELECT message FROM ProbesInMessages WHERE probe = %1)").arg(probe->id());
+  }
+}
+
+void DatabaseQueries::bindProbeFilter(QSqlQuery& q, const Search* probe) {
+  if (probe->filterType() == Search::FilterType::FullText) {
+    q.bindValue(QSL(":fltr"), probe->filter());
+  }
+}
+
+QHash<int, QString> DatabaseQueries::getRegexProbesForAccount(const QSqlDatabase& db, int account_id) {
+  QHash<int, QString> probes;
+  QSqlQuery q(db);
+
+  q.setForwardOnly(true);
+  q.prepare(QSL("SELECT id, fltr FROM Probes WHERE account_id = :account_id AND fltr_type = :fltr_type;"));
+  q.bindValue(QSL(":account_id"), account_id);
+  q.bindValue(QSL(":fltr_type"), int(Search::FilterType::RegularExpression));
+
+  if (!q.exec()) {
+    throw ApplicationException(q.lastError().text());
+  }
+
+  while (q.next()) {
+    probes.insert(q.value(0).toInt(), q.value(1).toString());
+  }
+
+  return probes;
+}
+
+QList<int> DatabaseQueries::getMessagesMatchingRegex(const QSqlDatabase& db,
+                                                     int account_id,
+                                                     const QRegularExpression& regex) {
+  QList<int> ids;
+  QSqlQuery q(db);
+
+  q.setForwardOnly(true);
+  q.prepare(QSL("SELECT id, title, contents FROM Messages WHERE account_id = :account_id;"));
+  q.bindValue(QSL(":account_id"), account_id);
+
+  if (!q.exec()) {
+    throw ApplicationException(q.lastError().text());
+  }
+
+  while (q.next()) {
+    if (regex.match(q.value(1).toString()).hasMatch() || regex.match(q.value(2).toString()).hasMatch()) {
+      ids.append(q.value(0).toInt());
+    }
+  }
+
+  return ids;
+}
+
+void DatabaseQueries::storeProbeHits(const QSqlDatabase& db, int account_id, const QList<QPair<int, int>>& hits) {
+  if (hits.isEmpty()) {
+    return;
+  }
+
+  QSqlQuery q(db);
+
+  q.setForwardOnly(true);
+  q.prepare(QSL("INSERT INTO ProbesInMessages (probe, message, account_id) VALUES (:probe, :message, :account_id);"));
+
+  for (const auto& hit : hits) {
+    q.bindValue(QSL(":probe"), hit.first);
+    q.bindValue(QSL(":message"), hit.second);
+    q.bindValue(QSL(":account_id"), account_id);
+
+    if (!q.exec()) {
+      throw ApplicationException(q.lastError().text());
+    }
+  }
+}
+
+void DatabaseQueries::removeProbeHits(const QSqlDatabase& db, int probe_id) {
+  QSqlQuery q(db);
+
+  q.setForwardOnly(true);
+  q.prepare(QSL("DELETE FROM ProbesInMessages WHERE probe = :probe;"));
+  q.bindValue(QSL(":probe"), probe_id);
+
+  if (!q.exec()) {
+    throw ApplicationException(q.lastError().text());
+  }
+}
+
+void DatabaseQueries::removeProbeHitsOfMessages(const QSqlDatabase& db, const QList<int>& message_ids) {
+  if (message_ids.isEmpty()) {
+    return;
+  }
+
+  QStringList ids;
+  QSqlQuery q(db);
+
+  ids.reserve(message_ids.size());
+
+  for (int id : message_ids) {
+    ids.append(QString::number(id));
+  }
+
+  q.setForwardOnly(true);
+
+  if (!q.exec(QSL("DELETE FROM ProbesInMessages WHERE message IN (%1);").arg(ids.join(QSL(", "))))) {
+    throw ApplicationException(q.lastError().text());
+  }
+}
+
 void DatabaseQueries::updateProbe(const QSqlDatabase& db, Search* probe) {
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-  q.prepare(QSL("UPDATE Probes SET name = :name, fltr = :fltr, color = :color "
+  q.prepare(QSL("UPDATE Probes SET name = :name, fltr = :fltr, fltr_type = :fltr_type, color = :color "
                 "WHERE id = :id AND account_id = :account_id;"));
   q.bindValue(QSL(":name"), probe->title());
   q.bindValue(QSL(":fltr"), probe->filter());
+  q.bindValue(QSL(":fltr_type"), int(probe->filterType()));
   q.bindValue(QSL(":color"), probe->color().name());
   q.bindValue(QSL(":id"), probe->id());
   q.bindValue(QSL(":account_id"), probe->getParentServiceRoot()->accountId());
@@ -310,10 +423,11 @@ void DatabaseQueries::createProbe(const QSqlDatabase& db, Search* probe, int acc
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-  q.prepare(QSL("INSERT INTO Probes (name, color, fltr, account_id) "
-                "VALUES (:name, :color, :fltr, :account_id);"));
+  q.prepare(QSL("INSERT INTO Probes (name, color, fltr, fltr_type, account_id) "
+                "VALUES (:name, :color, :fltr, :fltr_type, :account_id);"));
   q.bindValue(QSL(":name"), probe->title());
   q.bindValue(QSL(":fltr"), probe->filter());
+  q.bindValue(QSL(":fltr_type"), int(probe->filterType()));
   q.bindValue(QSL(":color"), probe->color().name());
   q.bindValue(QSL(":account_id"), account_id);
 
@@ -342,6 +456,7 @@ QList<Search*> DatabaseQueries::getProbesForAccount(const QSqlDatabase& db, int
                                 q.value(QSL("fltr")).toString(),
                                 QColor(q.value(QSL("color")).toString()));
 
+      prob->setFilterType(Search::FilterType(q.value(QSL("fltr_type")).toInt()));
       prob->setId(q.value(QSL("id")).toInt());
       prob->setCustomId(QString::number(prob->id()));
 
@@ -366,6 +481,8 @@ void DatabaseQueries::deleteProbe(const QSqlDatabase& db, Search* probe) {
   if (!q.exec()) {
     throw ApplicationException(q.lastError().text());
   }
+
+  removeProbeHits(db, probe->id());
 }
 
 bool DatabaseQueries::markLabelledMessagesReadUnread(const QSqlDatabase& db, Label* label, RootItem::ReadStatus read) {
@@ -377,10 +494,10 @@ bool DatabaseQueries::markLabelledMessagesReadUnread(const QSqlDatabase& db, Lab
                 "    is_deleted = 0 AND "
                 "    is_pdeleted = 0 AND "
                 "    account_id = :account_id AND "
-                "    labels LIKE :label;"));
+                "    id IN (SELECT message FROM LabelsInMessages WHERE label = :label AND account_id = :account_id);"));
   q.bindValue(QSL(":read"), read == RootItem::ReadStatus::Read ? 1 : 0);
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
-  q.bindValue(QSL(":label"), QSL("%.%1.%").arg(label->customId()));
+  q.bindValue(QSL(":label"), label->customId());
 
   return q.exec();
 }
@@ -419,6 +536,37 @@ bool DatabaseQueries::markMessagesReadUnread(const QSqlDatabase& db,
                   .arg(ids.join(QSL(", ")), read == RootItem::ReadStatus::Read ? QSL("1") : QSL("0")));
 }
 
+void DatabaseQueries::refreshMessageStates(const QSqlDatabase& db, QList<Message>& messages) {
+  if (messages.isEmpty()) {
+    return;
+  }
+
+  QHash<int, Message*> messages_by_id;
+  QStringList ids;
+
+  for (Message& msg : messages) {
+    messages_by_id.insert(msg.m_id, &msg);
+    ids.append(QString::number(msg.m_id));
+  }
+
+  QSqlQuery q(db);
+
+  q.setForwardOnly(true);
+
+  if (!q.exec(QSL("SELECT id, is_read, is_important FROM Messages WHERE id IN (%1);").arg(ids.join(QSL(", "))))) {
+    throw ApplicationException(q.lastError().text());
+  }
+
+  while (q.next()) {
+    Message* msg = messages_by_id.value(q.value(0).toInt());
+
+    if (msg != nullptr) {
+      msg->m_isRead = q.value(1).toBool();
+      msg->m_isImportant = q.value(2).toBool();
+    }
+  }
+}
+
 void DatabaseQueries::markMessagesReadUnreadImportant(const QSqlDatabase& db,
                                                       int account_id,
                                                       const QStringList& custom_ids,
@@ -478,6 +626,20 @@ bool DatabaseQueries::markMessageImportant(const QSqlDatabase& db, int id, RootI
   return q.exec();
 }
 
+void DatabaseQueries::updateMessageContents(const QSqlDatabase& db, const Message& msg) {
+  QSqlQuery q(db);
+
+  q.setForwardOnly(true);
+  q.prepare(QSL("UPDATE Messages SET contents = :contents, enclosures = :enclosures WHERE id = :id;"));
+  q.bindValue(QSL(":contents"), msg.m_contents);
+  q.bindValue(QSL(":enclosures"), Enclosures::encodeEnclosuresToString(msg.m_enclosures));
+  q.bindValue(QSL(":id"), msg.m_id);
+
+  if (!q.exec()) {
+    throw ApplicationException(q.lastError().text());
+  }
+}
+
 bool DatabaseQueries::markFeedsReadUnread(const QSqlDatabase& db,
                                           const QStringList& ids,
                                           int account_id,
@@ -849,10 +1011,10 @@ ArticleCounts DatabaseQueries::getMessageCountsForLabel(const QSqlDatabase& db,
                 "  is_deleted = 0 AND "
                 "  is_pdeleted = 0 AND "
                 "  account_id = :account_id AND "
-                "  labels LIKE :label;"));
+                "  id IN (SELECT message FROM LabelsInMessages WHERE label = :label AND account_id = :account_id);"));
 
   q.bindValue(QSL(":account_id"), account_id);
-  q.bindValue(QSL(":label"), QSL("%.%1.%").arg(label->customId()));
+  q.bindValue(QSL(":label"), label->customId());
 
   if (q.exec() && q.next()) {
     if (ok != nullptr) {
@@ -884,10 +1046,11 @@ ArticleCounts DatabaseQueries::getMessageCountsForProbe(const QSqlDatabase& db,
                 "  is_deleted = 0 AND "
                 "  is_pdeleted = 0 AND "
                 "  account_id = :account_id AND "
-                "  (title REGEXP :fltr OR contents REGEXP :fltr);"));
+                "  %1;")
+              .arg(probeCondition(probe, QSL(":fltr"))));
 
   q.bindValue(QSL(":account_id"), account_id);
-  q.bindValue(QSL(":fltr"), probe->filter());
+  bindProbeFilter(q, probe);
 
   if (q.exec() && q.next()) {
     ArticleCounts ac;
@@ -909,28 +1072,14 @@ QMap<QString, ArticleCounts> DatabaseQueries::getMessageCountsForAllLabels(const
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-
-  if (db.driverName() == QSL(APP_DB_MYSQL_DRIVER)) {
-    q.prepare(QSL("SELECT l.custom_id, CONCAT('%.', l.custom_id,'.%') pid, SUM(m.is_read), COUNT(*) FROM Labels l "
-                  "INNER JOIN Messages m "
-                  "  ON m.account_id = l.account_id AND m.labels LIKE pid "
-                  "WHERE "
-                  "  m.is_deleted = 0 AND "
-                  "  m.is_pdeleted = 0 AND "
-                  "  m.account_id = :account_id "
-                  "GROUP BY pid;"));
-  }
-  else {
-    q.prepare(QSL("SELECT l.custom_id, ('%.' || l.custom_id || '.%') pid, SUM(m.is_read), COUNT(*) FROM Labels l "
-                  "INNER JOIN Messages m "
-                  "  ON m.account_id = l.account_id AND m.labels LIKE pid "
-                  "WHERE "
-                  "  m.is_deleted = 0 AND "
-                  "  m.is_pdeleted = 0 AND "
-                  "  m.account_id = :account_id "
-                  "GROUP BY pid;"));
-  }
-
+  q.prepare(QSL("SELECT lm.label, SUM(m.is_read), COUNT(*) FROM LabelsInMessages lm "
+                "INNER JOIN Messages m "
+                "  ON m.id = lm.message "
+                "WHERE "
+                "  m.is_deleted = 0 AND "
+                "  m.is_pdeleted = 0 AND "
+                "  lm.account_id = :account_id "
+                "GROUP BY lm.label;"));
   q.bindValue(QSL(":account_id"), account_id);
 
   if (q.exec()) {
@@ -938,8 +1087,8 @@ QMap<QString, ArticleCounts> DatabaseQueries::getMessageCountsForAllLabels(const
       QString lbl_custom_id = q.value(0).toString();
       ArticleCounts ac;
 
-      ac.m_total = q.value(3).toInt();
-      ac.m_unread = ac.m_total - q.value(2).toInt();
+      ac.m_total = q.value(2).toInt();
+      ac.m_unread = ac.m_total - q.value(1).toInt();
 
       counts.insert(lbl_custom_id, ac);
     }
@@ -975,31 +1124,16 @@ QMap<QString, ArticleCounts> DatabaseQueries::getCountOfAssignedLabelsToMessages
   QStringList msgs_lst = FROM_STD_LIST(QStringList, msgs_std);
   auto msgs = msgs_lst.join(QSL(" OR "));
 
-  if (db.driverName() == QSL(APP_DB_MYSQL_DRIVER)) {
-    q.prepare(QSL("SELECT l.custom_id, CONCAT('%.', l.custom_id,'.%') pid, SUM(m.is_read), COUNT(*) FROM Labels l "
-                  "INNER JOIN Messages m "
-                  "  ON m.account_id = l.account_id AND m.labels LIKE pid "
-                  "WHERE "
-                  "  m.is_deleted = 0 AND "
-                  "  m.is_pdeleted = 0 AND "
-                  "  m.account_id = :account_id AND "
-                  " (%1) "
-                  "GROUP BY pid;")
-                .arg(msgs));
-  }
-  else {
-    q.prepare(QSL("SELECT l.custom_id, ('%.' || l.custom_id || '.%') pid, SUM(m.is_read), COUNT(*) FROM Labels l "
-                  "INNER JOIN Messages m "
-                  "  ON m.account_id = l.account_id AND m.labels LIKE pid "
-                  "WHERE "
-                  "  m.is_deleted = 0 AND "
-                  "  m.is_pdeleted = 0 AND "
-                  "  m.account_id = :account_id AND "
-                  " (%1) "
-                  "GROUP BY pid;")
-                .arg(msgs));
-  }
-
+  q.prepare(QSL("SELECT lm.label, SUM(m.is_read), COUNT(*) FROM LabelsInMessages lm "
+                "INNER JOIN Messages m "
+                "  ON m.id = lm.message "
+                "WHERE "
+                "  m.is_deleted = 0 AND "
+                "  m.is_pdeleted = 0 AND "
+                "  m.account_id = :account_id AND "
+                " (%1) "
+                "GROUP BY lm.label;")
+              .arg(msgs));
   q.bindValue(QSL(":account_id"), account_id);
 
   if (q.exec()) {
@@ -1007,8 +1141,8 @@ QMap<QString, ArticleCounts> DatabaseQueries::getCountOfAssignedLabelsToMessages
       QString lbl_custom_id = q.value(0).toString();
       ArticleCounts ac;
 
-      ac.m_total = q.value(3).toInt();
-      ac.m_unread = ac.m_total - q.value(2).toInt();
+      ac.m_total = q.value(2).toInt();
+      ac.m_unread = ac.m_total - q.value(1).toInt();
 
       counts.insert(lbl_custom_id, ac);
     }
@@ -1121,12 +1255,13 @@ QList<Message> DatabaseQueries::getUndeletedMessagesForProbe(const QSqlDatabase&
                 "  Messages.is_deleted = 0 AND "
                 "  Messages.is_pdeleted = 0 AND "
                 "  Messages.account_id = :account_id AND "
-                "  (title REGEXP :fltr OR contents REGEXP :fltr);")
+                "  %2;")
               .arg(messageTableAttributes(true, db.driverName() == QSL(APP_DB_SQLITE_DRIVER))
                      .values()
-                     .join(QSL(", "))));
+                     .join(QSL(", ")),
+                   probeCondition(probe, QSL(":fltr"))));
   q.bindValue(QSL(":account_id"), probe->getParentServiceRoot()->accountId());
-  q.bindValue(QSL(":fltr"), probe->filter());
+  bindProbeFilter(q, probe);
 
   if (q.exec()) {
     while (q.next()) {
@@ -1158,12 +1293,13 @@ QList<Message> DatabaseQueries::getUndeletedMessagesWithLabel(const QSqlDatabase
                 "  Messages.is_deleted = 0 AND "
                 "  Messages.is_pdeleted = 0 AND "
                 "  Messages.account_id = :account_id AND "
-                "  Messages.labels LIKE :label;")
+                "  Messages.id IN (SELECT message FROM LabelsInMessages WHERE label = :label AND account_id = "
+                ":account_id);")
               .arg(messageTableAttributes(false, db.driverName() == QSL(APP_DB_SQLITE_DRIVER))
                      .values()
                      .join(QSL(", "))));
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
-  q.bindValue(QSL(":label"), QSL("%.%1.%").arg(label->customId()));
+  q.bindValue(QSL(":label"), label->customId());
 
   if (q.exec()) {
     while (q.next()) {
@@ -1200,7 +1336,7 @@ QList<Message> DatabaseQueries::getUndeletedLabelledMessages(const QSqlDatabase&
                 "  Messages.is_deleted = 0 AND "
                 "  Messages.is_pdeleted = 0 AND "
                 "  Messages.account_id = :account_id AND "
-                "  LENGTH(Messages.labels) > 2;")
+                "  EXISTS (SELECT 1 FROM LabelsInMessages WHERE LabelsInMessages.message = Messages.id);")
               .arg(messageTableAttributes(false, db.driverName() == QSL(APP_DB_SQLITE_DRIVER))
                      .values()
                      .join(QSL(", "))));
@@ -1305,6 +1441,48 @@ QList<Message> DatabaseQueries::getUndeletedUnreadMessages(const QSqlDatabase& d
   return messages;
 }
 
+QHash<int, QString> DatabaseQueries::getArticlesContents(const QSqlDatabase& db, const QList<int>& ids, bool* ok) {
+  QHash<int, QString> contents;
+
+  contents.reserve(ids.size());
+
+  if (ok != nullptr) {
+    *ok = true;
+  }
+
+  for (int i = 0; i < ids.size(); i += DB_BULK_LOOKUP_SIZE) {
+    const QList<int> batch_ids = ids.mid(i, DB_BULK_LOOKUP_SIZE);
+    QString placeholders = QSL("?, ").repeated(batch_ids.size());
+
+    placeholders.chop(2);
+
+    QSqlQuery q(db);
+
+    q.setForwardOnly(true);
+    q.prepare(QSL("SELECT id, contents FROM Messages WHERE id IN (%1);").arg(placeholders));
+
+    for (int id : batch_ids) {
+      q.addBindValue(id);
+    }
+
+    if (!q.exec()) {
+      qWarningNN << LOGSEC_DB << "Failed to load contents of articles:" << QUOTE_W_SPACE_DOT(q.lastError().text());
+
+      if (ok != nullptr) {
+        *ok = false;
+      }
+
+      continue;
+    }
+
+    while (q.next()) {
+      contents.insert(q.value(0).toInt(), q.value(1).toString());
+    }
+  }
+
+  return contents;
+}
+
 QList<Message> DatabaseQueries::getArticlesSlice(const QSqlDatabase& db,
                                                  const QString& feed_custom_id,
                                                  int account_id,
@@ -1534,23 +1712,31 @@ QHash<QString, QStringList> DatabaseQueries::bagsOfMessages(const QSqlDatabase&
   QSqlQuery q(db);
 
   q.setForwardOnly(true);
-  q.prepare(QSL("SELECT custom_id FROM Messages "
+  q.prepare(QSL("SELECT lm.label, m.custom_id FROM LabelsInMessages lm "
+                "INNER JOIN Messages m "
+                "  ON m.id = lm.message "
                 "WHERE "
-                "  account_id = :account_id AND "
-                "  labels LIKE :label;"));
+                "  lm.account_id = :account_id;"));
+
+  // All label assignments of each account are fetched with single query.
+  QSet<int> account_ids;
 
   for (const Label* lbl : labels) {
-    q.bindValue(QSL(":label"), QSL("%.%1.%").arg(lbl->customId()));
-    q.bindValue(QSL(":account_id"), lbl->getParentServiceRoot()->accountId());
-    q.exec();
+    ids.insert(lbl->customId(), {});
+    account_ids.insert(lbl->getParentServiceRoot()->accountId());
+  }
 
-    QStringList ids_one_label;
+  for (int account_id : std::as_const(account_ids)) {
+    q.bindValue(QSL(":account_id"), account_id);
+    q.exec();
 
     while (q.next()) {
-      ids_one_label.append(q.value(0).toString());
-    }
+      auto lbl_ids = ids.find(q.value(0).toString());
 
-    ids.insert(lbl->customId(), ids_one_label);
+      if (lbl_ids != ids.end()) {
+        lbl_ids.value().append(q.value(1).toString());
+      }
+    }
   }
 
   return ids;
@@ -1562,55 +1748,155 @@ UpdatedArticles DatabaseQueries::updateMessages(const QSqlDatabase& db,
                                                 bool force_update,
                                                 QMutex* db_mutex,
                                                 bool* ok) {
+  if (ok != nullptr) {
+    *ok = messages.isEmpty();
+  }
+
   if (messages.isEmpty()) {
-    *ok = true;
     return {};
   }
 
   UpdatedArticles updated_messages;
   int account_id = feed->getParentServiceRoot()->accountId();
   auto feed_custom_id = feed->customId();
+  const bool is_syncable = feed->getParentServiceRoot()->isSyncable();
+  const bool ignore_contents_changes =
+    qApp->settings()->value(GROUP(Messages), SETTING(Messages::IgnoreContentsChanges)).toBool();
+
+  // Here we sort incoming messages into groups by the way we check for their existence in DB.
+  // Each group is then resolved with a few bulk lookups instead of one query per message.
+  //   1) Messages which already have primary DB ID. This is particularly the case when user runs
+  //      some message filter manually on existing messages of some feed.
+  //   2) Messages without custom ID. The two message are the "same" if they belong to the SAME FEED
+  //      AND have same URL AND same AUTHOR AND same TITLE.
+  //      NOTE: This only applies to messages from standard RSS/ATOM/JSON feeds without ID/GUID.
+  //   3) Messages with custom ID. For synchronized services (TT-RSS, Nextcloud News, ...) custom IDs
+  //      are service-wide, for standard RSS/ATOM/JSON feeds they are feed-specific.
+  QVariantList keys_ids, keys_titles, keys_custom_ids;
+
+  for (const Message& message : std::as_const(messages)) {
+    if (message.m_id > 0) {
+      keys_ids.append(message.m_id);
+    }
+    else if (message.m_customId.isEmpty()) {
+      keys_titles.append(unnulifyString(message.m_title));
+    }
+    else {
+      keys_custom_ids.append(unnulifyString(message.m_customId));
+    }
+  }
+
+  // MariaDB compares texts case-insensitively and ignores trailing spaces, keys must match
+  // the same articles as DB lookups do.
+  // NOTE: Default collation also treats accented letters as equal to plain ones, that is not
+  // replicated here, such articles are found by DB lookup but then considered new.
+  const bool case_insensitive_db = db.driverName() == QSL(APP_DB_MYSQL_DRIVER);
+  auto text_key = [case_insensitive_db](const QString& text) {
+    if (!case_insensitive_db) {
+      return text;
+    }
+
+    int length = text.size();
 
-  // Prepare queries.
-  QSqlQuery query_select_with_url(db);
-  QSqlQuery query_select_with_custom_id(db);
-  QSqlQuery query_select_with_custom_id_for_feed(db);
-  QSqlQuery query_select_with_id(db);
+    while (length > 0 && text.at(length - 1) == QL1C(' ')) {
+      length--;
+    }
+
+    return text.left(length).toCaseFolded();
+  };
+  auto url_key = [&](const QString& title, const QString& url, const QString& author) {
+    return text_key(title + QChar(0x1F) + url + QChar(0x1F) + author);
+  };
+
+  // Adds (or with negative "sign" removes) article in given state to count deltas.
+  auto count_article = [&](const QString& article_feed_id, bool is_read, bool is_important, bool is_deleted, int sign) {
+    const int unread_sign = is_read ? 0 : sign;
+
+    if (is_deleted) {
+      updated_messages.m_binCountsDelta.m_total += sign;
+      updated_messages.m_binCountsDelta.m_unread += unread_sign;
+    }
+    else if (article_feed_id != feed_custom_id) {
+      // Counts of other feed would change.
+      updated_messages.m_countsDeltaValid = false;
+    }
+    else {
+      updated_messages.m_feedCountsDelta.m_total += sign;
+      updated_messages.m_feedCountsDelta.m_unread += unread_sign;
+
+      if (is_important) {
+        updated_messages.m_importantCountsDelta.m_total += sign;
+        updated_messages.m_importantCountsDelta.m_unread += unread_sign;
+      }
+    }
+  };
+
+  QHash<int, ExistingArticle> existing_with_id;
+  QHash<QString, ExistingArticle> existing_with_url;
+  QHash<QString, ExistingArticle> existing_with_custom_id;
+
+  // Failed lookup is fatal, otherwise existing articles would be inserted again.
+  bool lookup_ok = false;
+  const auto existing_ids = existingArticles(db, QSL("id"), keys_ids, account_id, QString(), db_mutex, &lookup_ok);
+
+  if (!lookup_ok) {
+    return {};
+  }
+
+  const auto existing_titles =
+    existingArticles(db, QSL("title"), keys_titles, account_id, feed_custom_id, db_mutex, &lookup_ok);
+
+  if (!lookup_ok) {
+    return {};
+  }
+
+  const auto existing_custom_ids = existingArticles(db,
+                                                    QSL("custom_id"),
+                                                    keys_custom_ids,
+                                                    account_id,
+                                                    is_syncable ? QString() : feed_custom_id,
+                                                    db_mutex,
+                                                    &lookup_ok);
+
+  if (!lookup_ok) {
+    return {};
+  }
+
+  for (const ExistingArticle& existing : existing_ids) {
+    if (!existing_with_id.contains(existing.m_id)) {
+      existing_with_id.insert(existing.m_id, existing);
+    }
+  }
+
+  for (const ExistingArticle& existing : existing_titles) {
+    const QString key = url_key(existing.m_title, existing.m_url, existing.m_author);
+
+    if (!existing_with_url.contains(key)) {
+      existing_with_url.insert(key, existing);
+    }
+  }
+
+  for (const ExistingArticle& existing : existing_custom_ids) {
+    const QString key = text_key(existing.m_customId);
+
+    if (!existing_with_custom_id.contains(key)) {
+      existing_with_custom_id.insert(key, existing);
+    }
+  }
+
+  qDebugNN << LOGSEC_DB << "Bulk lookup found" << QUOTE_W_SPACE(existing_with_id.size())
+           << "articles via primary ID," << QUOTE_W_SPACE(existing_with_url.size())
+           << "articles via URL/TITLE/AUTHOR and" << QUOTE_W_SPACE(existing_with_custom_id.size())
+           << "articles via custom ID.";
+
+  // Used to update existing messages, all changed messages are updated in one batch.
   QSqlQuery query_update(db);
+  QVariantList upd_titles, upd_is_reads, upd_is_importants, upd_is_deleteds, upd_urls, upd_authors, upd_scores,
+    upd_dates, upd_contents, upd_enclosures, upd_feeds, upd_ids;
+  QVector<Message*> msgs_to_update;
+  QVector<const ExistingArticle*> existing_to_update;
+  QVector<Message*> msgs_to_insert;
 
-  // Here we have query which will check for existence of the "same" message in given feed.
-  // The two message are the "same" if:
-  //   1) they belong to the SAME FEED AND,
-  //   2) they have same URL AND,
-  //   3) they have same AUTHOR AND,
-  //   4) they have same TITLE.
-  // NOTE: This only applies to messages from standard RSS/ATOM/JSON feeds without ID/GUID.
-  query_select_with_url.setForwardOnly(true);
-  query_select_with_url.prepare(QSL("SELECT id, date_created, is_read, is_important, contents, feed FROM Messages "
-                                    "WHERE feed = :feed AND title = :title AND url = :url AND author = :author AND "
-                                    "account_id = :account_id;"));
-
-  // When we have custom ID of the message which is service-specific (synchronized services).
-  query_select_with_custom_id.setForwardOnly(true);
-  query_select_with_custom_id
-    .prepare(QSL("SELECT id, date_created, is_read, is_important, contents, feed, title, author FROM Messages "
-                 "WHERE custom_id = :custom_id AND account_id = :account_id;"));
-
-  // We have custom ID of message, but it is feed-specific not service-specific (standard RSS/ATOM/JSON).
-  query_select_with_custom_id_for_feed.setForwardOnly(true);
-  query_select_with_custom_id_for_feed
-    .prepare(QSL("SELECT id, date_created, is_read, is_important, contents, title, author FROM Messages "
-                 "WHERE feed = :feed AND custom_id = :custom_id AND account_id = :account_id;"));
-
-  // In some case, messages are already stored in the DB and they all have primary DB ID.
-  // This is particularly the case when user runs some message filter manually on existing messages
-  // of some feed.
-  query_select_with_id.setForwardOnly(true);
-  query_select_with_id
-    .prepare(QSL("SELECT date_created, is_read, is_important, contents, feed, title, author FROM Messages "
-                 "WHERE id = :id AND account_id = :account_id;"));
-
-  // Used to update existing messages.
   query_update.setForwardOnly(true);
   query_update.prepare(QSL("UPDATE Messages "
                            "SET title = :title, is_read = :is_read, is_important = :is_important, is_deleted = "
@@ -1618,316 +1904,254 @@ UpdatedArticles DatabaseQueries::updateMessages(const QSqlDatabase& db,
                            "contents = :contents, enclosures = :enclosures, feed = :feed "
                            "WHERE id = :id;"));
 
-  QVector<Message*> msgs_to_insert;
-
   for (Message& message : messages) {
-    int id_existing_message = -1;
-    qint64 date_existing_message = 0;
-    bool is_read_existing_message = false;
-    bool is_important_existing_message = false;
-    QString contents_existing_message;
-    QString feed_id_existing_message;
-    QString title_existing_message;
-    QString author_existing_message;
-
-    QMutexLocker lck(db_mutex);
+    const ExistingArticle* existing = nullptr;
 
     if (message.m_id > 0) {
-      // We recognize directly existing message.
-      // NOTE: Particularly for manual message filter execution.
-      query_select_with_id.bindValue(QSL(":id"), message.m_id);
-      query_select_with_id.bindValue(QSL(":account_id"), account_id);
-
-      qDebugNN << LOGSEC_DB << "Checking if message with primary ID" << QUOTE_W_SPACE(message.m_id)
-               << "is present in DB.";
-
-      if (query_select_with_id.exec() && query_select_with_id.next()) {
-        id_existing_message = message.m_id;
-        date_existing_message = query_select_with_id.value(0).value<qint64>();
-        is_read_existing_message = query_select_with_id.value(1).toBool();
-        is_important_existing_message = query_select_with_id.value(2).toBool();
-        contents_existing_message = query_select_with_id.value(3).toString();
-        feed_id_existing_message = query_select_with_id.value(4).toString();
-        title_existing_message = query_select_with_id.value(5).toString();
-        author_existing_message = query_select_with_id.value(6).toString();
-
-        qDebugNN << LOGSEC_DB << "Message with direct DB ID is already present in DB and has DB ID"
-                 << QUOTE_W_SPACE_DOT(id_existing_message);
-      }
-      else if (query_select_with_id.lastError().isValid()) {
-        qWarningNN << LOGSEC_DB << "Failed to check for existing message in DB via primary ID:"
-                   << QUOTE_W_SPACE_DOT(query_select_with_id.lastError().text());
-      }
+      auto found = existing_with_id.constFind(message.m_id);
 
-      query_select_with_id.finish();
+      if (found != existing_with_id.constEnd()) {
+        existing = &found.value();
+      }
     }
     else if (message.m_customId.isEmpty()) {
-      // We need to recognize existing messages according to URL & AUTHOR & TITLE.
-      // NOTE: This concerns articles from RSS/ATOM/JSON which do not
-      // provide unique ID/GUID.
-      query_select_with_url.bindValue(QSL(":feed"), unnulifyString(feed_custom_id));
-      query_select_with_url.bindValue(QSL(":title"), unnulifyString(message.m_title));
-      query_select_with_url.bindValue(QSL(":url"), unnulifyString(message.m_url));
-      query_select_with_url.bindValue(QSL(":author"), unnulifyString(message.m_author));
-      query_select_with_url.bindValue(QSL(":account_id"), account_id);
-
-      qDebugNN << LOGSEC_DB << "Checking if message with title " << QUOTE_NO_SPACE(message.m_title) << ", url "
-               << QUOTE_NO_SPACE(message.m_url) << "' and author " << QUOTE_NO_SPACE(message.m_author)
-               << " is present in DB.";
-
-      if (query_select_with_url.exec() && query_select_with_url.next()) {
-        id_existing_message = query_select_with_url.value(0).toInt();
-        date_existing_message = query_select_with_url.value(1).value<qint64>();
-        is_read_existing_message = query_select_with_url.value(2).toBool();
-        is_important_existing_message = query_select_with_url.value(3).toBool();
-        contents_existing_message = query_select_with_url.value(4).toString();
-        feed_id_existing_message = query_select_with_url.value(5).toString();
-        title_existing_message = unnulifyString(message.m_title);
-        author_existing_message = unnulifyString(message.m_author);
-
-        qDebugNN << LOGSEC_DB << "Message with these attributes is already present in DB and has DB ID"
-                 << QUOTE_W_SPACE_DOT(id_existing_message);
-      }
-      else if (query_select_with_url.lastError().isValid()) {
-        qWarningNN << LOGSEC_DB << "Failed to check for existing message in DB via URL/TITLE/AUTHOR:"
-                   << QUOTE_W_SPACE_DOT(query_select_with_url.lastError().text());
-      }
+      auto found = existing_with_url.constFind(url_key(unnulifyString(message.m_title),
+                                                       unnulifyString(message.m_url),
+                                                       unnulifyString(message.m_author)));
 
-      query_select_with_url.finish();
+      if (found != existing_with_url.constEnd()) {
+        existing = &found.value();
+      }
     }
     else {
-      // We can recognize existing messages via their custom ID.
-      if (feed->getParentServiceRoot()->isSyncable()) {
-        // Custom IDs are service-wide.
-        // NOTE: This concerns messages from custom accounts, like TT-RSS or Nextcloud News.
-        query_select_with_custom_id.bindValue(QSL(":account_id"), account_id);
-        query_select_with_custom_id.bindValue(QSL(":custom_id"), unnulifyString(message.m_customId));
-
-        qDebugNN << LOGSEC_DB << "Checking if message with service-specific custom ID"
-                 << QUOTE_W_SPACE(message.m_customId) << "is present in DB.";
-
-        if (query_select_with_custom_id.exec() && query_select_with_custom_id.next()) {
-          id_existing_message = query_select_with_custom_id.value(0).toInt();
-          date_existing_message = query_select_with_custom_id.value(1).value<qint64>();
-          is_read_existing_message = query_select_with_custom_id.value(2).toBool();
-          is_important_existing_message = query_select_with_custom_id.value(3).toBool();
-          contents_existing_message = query_select_with_custom_id.value(4).toString();
-          feed_id_existing_message = query_select_with_custom_id.value(5).toString();
-          title_existing_message = query_select_with_custom_id.value(6).toString();
-          author_existing_message = query_select_with_custom_id.value(7).toString();
-
-          qDebugNN << LOGSEC_DB << "Message with custom ID" << QUOTE_W_SPACE(message.m_customId)
-                   << "is already present in DB and has DB ID '" << id_existing_message << "'.";
-        }
-        else if (query_select_with_custom_id.lastError().isValid()) {
-          qWarningNN << LOGSEC_DB << "Failed to check for existing message in DB via ID:"
-                     << QUOTE_W_SPACE_DOT(query_select_with_custom_id.lastError().text());
-        }
+      auto found = existing_with_custom_id.constFind(text_key(unnulifyString(message.m_customId)));
 
-        query_select_with_custom_id.finish();
+      if (found != existing_with_custom_id.constEnd()) {
+        existing = &found.value();
       }
-      else {
-        // Custom IDs are feed-specific.
-        // NOTE: This concerns articles with ID/GUID from standard RSS/ATOM/JSON feeds.
-        query_select_with_custom_id_for_feed.bindValue(QSL(":account_id"), account_id);
-        query_select_with_custom_id_for_feed.bindValue(QSL(":feed"), feed_custom_id);
-        query_select_with_custom_id_for_feed.bindValue(QSL(":custom_id"), unnulifyString(message.m_customId));
-
-        qDebugNN << LOGSEC_DB << "Checking if message with feed-specific custom ID" << QUOTE_W_SPACE(message.m_customId)
-                 << "is present in DB.";
-
-        if (query_select_with_custom_id_for_feed.exec() && query_select_with_custom_id_for_feed.next()) {
-          id_existing_message = query_select_with_custom_id_for_feed.value(0).toInt();
-          date_existing_message = query_select_with_custom_id_for_feed.value(1).value<qint64>();
-          is_read_existing_message = query_select_with_custom_id_for_feed.value(2).toBool();
-          is_important_existing_message = query_select_with_custom_id_for_feed.value(3).toBool();
-          contents_existing_message = query_select_with_custom_id_for_feed.value(4).toString();
-          feed_id_existing_message = feed_custom_id;
-          title_existing_message = query_select_with_custom_id_for_feed.value(5).toString();
-          author_existing_message = query_select_with_custom_id_for_feed.value(6).toString();
-
-          qDebugNN << LOGSEC_DB << "Message with custom ID" << QUOTE_W_SPACE(message.m_customId)
-                   << "is already present in DB and has DB ID" << QUOTE_W_SPACE_DOT(id_existing_message);
-        }
-        else if (query_select_with_custom_id_for_feed.lastError().isValid()) {
-          qWarningNN << LOGSEC_DB << "Failed to check for existing message in DB via ID:"
-                     << QUOTE_W_SPACE_DOT(query_select_with_custom_id_for_feed.lastError().text());
-        }
+    }
 
-        query_select_with_custom_id_for_feed.finish();
-      }
+    if (existing == nullptr) {
+      msgs_to_insert.append(&message);
+      continue;
     }
 
-    // Now, check if this message is already in the DB.
-    if (id_existing_message >= 0) {
-      message.m_id = id_existing_message;
-
-      // Message is already in the DB.
-      //
-      // Now, we update it if at least one of next conditions is true:
-      //   1) FOR SYNCHRONIZED SERVICES:
-      //        Message has custom ID AND (its date OR read status OR starred status are changed
-      //        or message was moved from other feed to current feed - this can particularly happen in Gmail feeds).
-      //
-      //   2) FOR NON-SYNCHRONIZED SERVICES (RSS/ATOM/JSON):
-      //        Message has custom ID/GUID and its title or author or contents are changed.
-      //
-      //   3) FOR ALL SERVICES:
-      //        Message has its date fetched from feed AND its date is different
-      //        from date in DB or content is changed. Date/time is considered different
-      //        when the difference is larger than MSG_DATETIME_DIFF_THRESSHOLD
-      //
-      //   4) FOR ALL SERVICES:
-      //        Message update is forced, we want to overwrite message as some arbitrary atribute was changed,
-      //        this particularly happens when manual message filter execution happens.
-      bool ignore_contents_changes =
-        qApp->settings()->value(GROUP(Messages), SETTING(Messages::IgnoreContentsChanges)).toBool();
-      bool cond_1 =
-        !message.m_customId.isEmpty() && feed->getParentServiceRoot()->isSyncable() &&
-        (message.m_created.toMSecsSinceEpoch() != date_existing_message ||
-         message.m_isRead != is_read_existing_message || message.m_isImportant != is_important_existing_message ||
-         (message.m_feedId != feed_id_existing_message && message.m_feedId == feed_custom_id) ||
-         message.m_title != title_existing_message ||
-         (!ignore_contents_changes && message.m_contents != contents_existing_message));
-      bool cond_2 = !message.m_customId.isEmpty() && !feed->getParentServiceRoot()->isSyncable() &&
-                    (message.m_title != title_existing_message || message.m_author != author_existing_message ||
-                     (!ignore_contents_changes && message.m_contents != contents_existing_message));
-      bool cond_3 = (message.m_createdFromFeed && std::abs(message.m_created.toMSecsSinceEpoch() -
-                                                           date_existing_message) > MSG_DATETIME_DIFF_THRESSHOLD) ||
-                    (!ignore_contents_changes && message.m_contents != contents_existing_message);
-
-      if (cond_1 || cond_2 || cond_3 || force_update) {
-        if (!feed->getParentServiceRoot()->isSyncable()) {
-          // Feed is not syncable, thus we got RSS/JSON/whatever.
-          // Article is only updated, so we now prefer to keep original read state
-          // pretty much the same way starred state is kept.
-          message.m_isRead = is_read_existing_message;
-        }
+    message.m_id = existing->m_id;
 
-        // Message exists and is changed, update it.
-        query_update.bindValue(QSL(":title"), unnulifyString(message.m_title));
-        query_update.bindValue(QSL(":is_read"), int(message.m_isRead));
-        query_update.bindValue(QSL(":is_important"),
-                               (feed->getParentServiceRoot()->isSyncable() || message.m_isImportant)
-                                 ? int(message.m_isImportant)
-                                 : is_important_existing_message);
-        query_update.bindValue(QSL(":is_deleted"), int(message.m_isDeleted));
-        query_update.bindValue(QSL(":url"), unnulifyString(message.m_url));
-        query_update.bindValue(QSL(":author"), unnulifyString(message.m_author));
-        query_update.bindValue(QSL(":date_created"), message.m_created.toMSecsSinceEpoch());
-        query_update.bindValue(QSL(":contents"), unnulifyString(message.m_contents));
-        query_update.bindValue(QSL(":enclosures"), Enclosures::encodeEnclosuresToString(message.m_enclosures));
-        query_update.bindValue(QSL(":feed"), message.m_feedId);
-        query_update.bindValue(QSL(":score"), message.m_score);
-        query_update.bindValue(QSL(":id"), id_existing_message);
-
-        if (query_update.exec()) {
-          qDebugNN << LOGSEC_DB << "Overwriting message with title" << QUOTE_W_SPACE(message.m_title) << "URL"
-                   << QUOTE_W_SPACE(message.m_url) << "in DB.";
-
-          if (!message.m_isRead) {
-            updated_messages.m_unread.append(message);
-          }
-
-          updated_messages.m_all.append(message);
-          message.m_insertedUpdated = true;
-        }
-        else if (query_update.lastError().isValid()) {
-          qCriticalNN << LOGSEC_DB
-                      << "Failed to update message in DB:" << QUOTE_W_SPACE_DOT(query_update.lastError().text());
+    // Message is already in the DB.
+    //
+    // Now, we update it if at least one of next conditions is true:
+    //   1) FOR SYNCHRONIZED SERVICES:
+    //        Message has custom ID AND (its date OR read status OR starred status are changed
+    //        or message was moved from other feed to current feed - this can particularly happen in Gmail feeds).
+    //
+    //   2) FOR NON-SYNCHRONIZED SERVICES (RSS/ATOM/JSON):
+    //        Message has custom ID/GUID and its title or author or contents are changed.
+    //
+    //   3) FOR ALL SERVICES:
+    //        Message has its date fetched from feed AND its date is different
+    //        from date in DB or content is changed. Date/time is considered different
+    //        when the difference is larger than MSG_DATETIME_DIFF_THRESSHOLD
+    //
+    //   4) FOR ALL SERVICES:
+    //        Message update is forced, we want to overwrite message as some arbitrary atribute was changed,
+    //        this particularly happens when manual message filter execution happens.
+    bool cond_1 = !message.m_customId.isEmpty() && is_syncable &&
+                  (message.m_created.toMSecsSinceEpoch() != existing->m_created ||
+                   message.m_isRead != existing->m_isRead || message.m_isImportant != existing->m_isImportant ||
+                   (message.m_feedId != existing->m_feedId && message.m_feedId == feed_custom_id) ||
+                   message.m_title != existing->m_title ||
+                   (!ignore_contents_changes && message.m_contents != existing->m_contents));
+    bool cond_2 = !message.m_customId.isEmpty() && !is_syncable &&
+                  (message.m_title != existing->m_title || message.m_author != existing->m_author ||
+                   (!ignore_contents_changes && message.m_contents != existing->m_contents));
+    bool cond_3 = (message.m_createdFromFeed &&
+                   std::abs(message.m_created.toMSecsSinceEpoch() - existing->m_created) >
+                     MSG_DATETIME_DIFF_THRESSHOLD) ||
+                  (!ignore_contents_changes && message.m_contents != existing->m_contents);
+
+    if (cond_1 || cond_2 || cond_3 || force_update) {
+      if (!is_syncable) {
+        // Feed is not syncable, thus we got RSS/JSON/whatever.
+        // Article is only updated, so we now prefer to keep original read state
+        // pretty much the same way starred state is kept.
+        message.m_isRead = existing->m_isRead;
+      }
+
+      upd_titles.append(unnulifyString(message.m_title));
+      upd_is_reads.append(int(message.m_isRead));
+      upd_is_importants.append(int((is_syncable || message.m_isImportant) ? message.m_isImportant
+                                                                          : existing->m_isImportant));
+      upd_is_deleteds.append(int(message.m_isDeleted));
+      upd_urls.append(unnulifyString(message.m_url));
+      upd_authors.append(unnulifyString(message.m_author));
+      upd_scores.append(message.m_score);
+      upd_dates.append(message.m_created.toMSecsSinceEpoch());
+      upd_contents.append(unnulifyString(message.m_contents));
+      upd_enclosures.append(Enclosures::encodeEnclosuresToString(message.m_enclosures));
+      upd_feeds.append(message.m_feedId);
+      upd_ids.append(existing->m_id);
+
+      msgs_to_update.append(&message);
+      existing_to_update.append(existing);
+    }
+  }
+
+  if (!msgs_to_update.isEmpty()) {
+    query_update.bindValue(QSL(":title"), upd_titles);
+    query_update.bindValue(QSL(":is_read"), upd_is_reads);
+    query_update.bindValue(QSL(":is_important"), upd_is_importants);
+    query_update.bindValue(QSL(":is_deleted"), upd_is_deleteds);
+    query_update.bindValue(QSL(":url"), upd_urls);
+    query_update.bindValue(QSL(":author"), upd_authors);
+    query_update.bindValue(QSL(":date_created"), upd_dates);
+    query_update.bindValue(QSL(":contents"), upd_contents);
+    query_update.bindValue(QSL(":enclosures"), upd_enclosures);
+    query_update.bindValue(QSL(":feed"), upd_feeds);
+    query_update.bindValue(QSL(":score"), upd_scores);
+    query_update.bindValue(QSL(":id"), upd_ids);
+
+    QMutexLocker lck(db_mutex);
+
+    if (query_update.execBatch()) {
+      qDebugNN << LOGSEC_DB << "Overwritten" << QUOTE_W_SPACE(msgs_to_update.size()) << "messages in DB.";
+
+      for (int i = 0; i < msgs_to_update.size(); i++) {
+        Message* msg = msgs_to_update[i];
+        const ExistingArticle* existing = existing_to_update[i];
+
+        if (!msg->m_isRead) {
+          updated_messages.m_unread.append(*msg);
         }
 
-        query_update.finish();
+        updated_messages.m_all.append(*msg);
+        msg->m_insertedUpdated = true;
+
+        // Purged articles are not counted anywhere and they stay purged.
+        if (!existing->m_isPdeleted) {
+          count_article(existing->m_feedId, existing->m_isRead, existing->m_isImportant, existing->m_isDeleted, -1);
+          count_article(msg->m_feedId,
+                        upd_is_reads[i].toBool(),
+                        upd_is_importants[i].toBool(),
+                        msg->m_isDeleted,
+                        1);
+        }
       }
+
+      // Updated articles might carry some labels.
+      updated_messages.m_labelsChanged = true;
     }
     else {
-      msgs_to_insert.append(&message);
-    }
-  }
+      qCriticalNN << LOGSEC_DB
+                  << "Failed to update messages in DB:" << QUOTE_W_SPACE_DOT(query_update.lastError().text());
+      return {};
+    }
+
+    query_update.finish();
+  }
+
+  // Messages which do not meet DB constraints are left out right away, so that
+  // each inserted row maps exactly to one message of its batch.
+  msgs_to_insert.erase(std::remove_if(msgs_to_insert.begin(),
+                                      msgs_to_insert.end(),
+                                      [](Message* msg) {
+                                        if (msg->m_title.isEmpty()) {
+                                          qCriticalNN << LOGSEC_DB << "Message" << QUOTE_W_SPACE(msg->m_customId)
+                                                      << "will not be inserted to DB because it does not meet DB "
+                                                         "constraints.";
+                                          return true;
+                                        }
+                                        else {
+                                          return false;
+                                        }
+                                      }),
+                       msgs_to_insert.end());
 
   if (!msgs_to_insert.isEmpty()) {
-    QString bulk_insert = QSL("INSERT INTO Messages "
-                              "(feed, title, is_read, is_important, is_deleted, url, author, score, date_created, "
-                              "contents, enclosures, custom_id, custom_hash, account_id) "
-                              "VALUES %1;");
+    // Articles are inserted with prepared multi-row statement whose values are bound,
+    // so that article contents are neither copied nor escaped and SQL is not reparsed for each batch.
+    //
+    // We calculate real IDs of inserted rows because of how "auto-increment" algorithms work.
+    // SQLite reports ID of the last row inserted by the statement, MariaDB reports ID of the first one.
+    //   https://www.sqlite.org/autoinc.html
+    //   https://mariadb.com/kb/en/auto_increment
+    const bool last_insert_id_is_first = db.driverName() == QSL(APP_DB_MYSQL_DRIVER);
+    QSqlQuery query_insert(db);
+    int prepared_rows = 0;
+
+    query_insert.setForwardOnly(true);
+
+    for (int i = 0; i < msgs_to_insert.size(); i += DB_BULK_INSERT_ROWS) {
+      const int batch_length = std::min(DB_BULK_INSERT_ROWS, int(msgs_to_insert.size()) - i);
+
+      if (batch_length != prepared_rows) {
+        // All batches but the last one have the same size, so we usually prepare only once or twice.
+        QString rows = QSL("(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?), ").repeated(batch_length);
+
+        rows.chop(2);
+
+        if (!query_insert.prepare(QSL("INSERT INTO Messages "
+                                      "(feed, title, is_read, is_important, is_deleted, url, author, score, "
+                                      "date_created, contents, enclosures, custom_id, custom_hash, account_id) "
+                                      "VALUES %1;")
+                                    .arg(rows))) {
+          qCriticalNN << LOGSEC_DB << "Failed to prepare bulk insert of articles:"
+                      << QUOTE_W_SPACE_DOT(query_insert.lastError().text());
+          return {};
+        }
+
+        prepared_rows = batch_length;
+      }
 
-    for (int i = 0; i < msgs_to_insert.size(); i += 1000) {
-      QStringList vals;
-      int batch_length = std::min(1000, int(msgs_to_insert.size()) - i);
+      int pos = 0;
 
       for (int l = i; l < (i + batch_length); l++) {
-        Message* msg = msgs_to_insert[l];
+        const Message* msg = msgs_to_insert[l];
+
+        query_insert.bindValue(pos++, unnulifyString(feed_custom_id));
+        query_insert.bindValue(pos++, unnulifyString(msg->m_title));
+        query_insert.bindValue(pos++, int(msg->m_isRead));
+        query_insert.bindValue(pos++, int(msg->m_isImportant));
+        query_insert.bindValue(pos++, int(msg->m_isDeleted));
+        query_insert.bindValue(pos++, unnulifyString(msg->m_url));
+        query_insert.bindValue(pos++, unnulifyString(msg->m_author));
+        query_insert.bindValue(pos++, msg->m_score);
+        query_insert.bindValue(pos++, msg->m_created.toMSecsSinceEpoch());
+        query_insert.bindValue(pos++, unnulifyString(msg->m_contents));
+        query_insert.bindValue(pos++, Enclosures::encodeEnclosuresToString(msg->m_enclosures));
+        query_insert.bindValue(pos++, unnulifyString(msg->m_customId));
+        query_insert.bindValue(pos++, unnulifyString(msg->m_customHash));
+        query_insert.bindValue(pos++, account_id);
+      }
 
-        if (msg->m_title.isEmpty()) {
-          qCriticalNN << LOGSEC_DB << "Message" << QUOTE_W_SPACE(msg->m_customId)
-                      << "will not be inserted to DB because it does not meet DB constraints.";
+      QMutexLocker lck(db_mutex);
 
-          continue;
-        }
+      if (!query_insert.exec()) {
+        auto bulk_error = query_insert.lastError();
+        QString txt = bulk_error.text() + bulk_error.databaseText() + bulk_error.driverText();
 
-        vals.append(QSL("\n(':feed', ':title', :is_read, :is_important, :is_deleted, "
-                        "':url', ':author', :score, :date_created, ':contents', ':enclosures', "
-                        "':custom_id', ':custom_hash', :account_id)")
-                      .replace(QSL(":feed"), unnulifyString(feed_custom_id))
-                      .replace(QSL(":title"), DatabaseFactory::escapeQuery(unnulifyString(msg->m_title)))
-                      .replace(QSL(":is_read"), QString::number(int(msg->m_isRead)))
-                      .replace(QSL(":is_important"), QString::number(int(msg->m_isImportant)))
-                      .replace(QSL(":is_deleted"), QString::number(int(msg->m_isDeleted)))
-                      .replace(QSL(":url"), DatabaseFactory::escapeQuery(unnulifyString(msg->m_url)))
-                      .replace(QSL(":author"), DatabaseFactory::escapeQuery(unnulifyString(msg->m_author)))
-                      .replace(QSL(":date_created"), QString::number(msg->m_created.toMSecsSinceEpoch()))
-                      .replace(QSL(":contents"), DatabaseFactory::escapeQuery(unnulifyString(msg->m_contents)))
-                      .replace(QSL(":enclosures"),
-                               DatabaseFactory::escapeQuery(Enclosures::encodeEnclosuresToString(msg->m_enclosures)))
-                      .replace(QSL(":custom_id"), DatabaseFactory::escapeQuery(unnulifyString(msg->m_customId)))
-                      .replace(QSL(":custom_hash"), unnulifyString(msg->m_customHash))
-                      .replace(QSL(":score"), QString::number(msg->m_score))
-                      .replace(QSL(":account_id"), QString::number(account_id)));
+        qCriticalNN << LOGSEC_DB << "Failed bulk insert of articles:" << QUOTE_W_SPACE_DOT(txt);
+        return {};
       }
 
-      if (!vals.isEmpty()) {
-        QString final_bulk = bulk_insert.arg(vals.join(QSL(", ")));
-
-        QMutexLocker lck(db_mutex);
+      const int reported_id = query_insert.lastInsertId().toInt();
+      const int first_msg_id = last_insert_id_is_first ? reported_id : (reported_id - batch_length + 1);
 
-        auto bulk_query = QSqlQuery(final_bulk, db);
-        auto bulk_error = bulk_query.lastError();
+      for (int l = i; l < (i + batch_length); l++) {
+        Message* msg = msgs_to_insert[l];
 
-        if (bulk_error.isValid()) {
-          QString txt = bulk_error.text() + bulk_error.databaseText() + bulk_error.driverText();
+        msg->m_insertedUpdated = true;
+        msg->m_id = first_msg_id + (l - i);
 
-          qCriticalNN << LOGSEC_DB << "Failed bulk insert of articles:" << QUOTE_W_SPACE_DOT(txt);
-        }
-        else {
-          // OK, we bulk-inserted many messages but the thing is that they do not
-          // have their DB IDs fetched in objects, therefore labels cannot be assigned etc.
-          //
-          // We can calculate real IDs because of how "auto-increment" algorithms work.
-          //   https://www.sqlite.org/autoinc.html
-          //   https://mariadb.com/kb/en/auto_increment
-          int last_msg_id = bulk_query.lastInsertId().toInt();
-
-          for (int l = i, c = 1; l < (i + batch_length); l++, c++) {
-            Message* msg = msgs_to_insert[l];
-
-            if (msg->m_title.isEmpty()) {
-              // This article was not for sure inserted. Tweak
-              // next ID calculation.
-              c--;
-              continue;
-            }
-
-            msg->m_insertedUpdated = true;
-            msg->m_id = last_msg_id - batch_length + c;
-
-            if (!msg->m_isRead) {
-              updated_messages.m_unread.append(*msg);
-            }
-
-            updated_messages.m_all.append(*msg);
-          }
+        if (!msg->m_isRead) {
+          updated_messages.m_unread.append(*msg);
         }
+
+        updated_messages.m_all.append(*msg);
+        count_article(feed_custom_id, msg->m_isRead, msg->m_isImportant, msg->m_isDeleted, 1);
       }
+
+      query_insert.finish();
     }
   }
 
@@ -1945,6 +2169,11 @@ UpdatedArticles DatabaseQueries::updateMessages(const QSqlDatabase& db,
         // lbls_changed = true;
       }
 
+      if (uses_online_labels || !message.m_assignedLabelsByFilter.isEmpty() ||
+          !message.m_deassignedLabelsByFilter.isEmpty()) {
+        updated_messages.m_labelsChanged = true;
+      }
+
       // Adjust labels tweaked by filters.
       for (Label* assigned_by_filter : message.m_assignedLabelsByFilter) {
         assigned_by_filter->assignToMessage(message, false);
@@ -1994,6 +2223,7 @@ UpdatedArticles DatabaseQueries::updateMessages(const QSqlDatabase& db,
   if (fixup_custom_ids_error.isValid()) {
     qCriticalNN << LOGSEC_DB
                 << "Failed to set custom ID for all messages:" << QUOTE_W_SPACE_DOT(fixup_custom_ids_error.text());
+    return {};
   }
 
   if (ok != nullptr) {
@@ -2003,6 +2233,74 @@ UpdatedArticles DatabaseQueries::updateMessages(const QSqlDatabase& db,
   return updated_messages;
 }
 
+QList<DatabaseQueries::ExistingArticle> DatabaseQueries::existingArticles(const QSqlDatabase& db,
+                                                                         const QString& key_column,
+                                                                         const QVariantList& keys,
+                                                                         int account_id,
+                                                                         const QString& feed_custom_id,
+                                                                         QMutex* db_mutex,
+                                                                         bool* ok) {
+  QList<ExistingArticle> existing;
+
+  *ok = true;
+
+  for (int i = 0; i < keys.size(); i += DB_BULK_LOOKUP_SIZE) {
+    const QVariantList batch_keys = keys.mid(i, DB_BULK_LOOKUP_SIZE);
+    QString placeholders = QSL("?, ").repeated(batch_keys.size());
+
+    placeholders.chop(2);
+
+    QSqlQuery q(db);
+
+    q.setForwardOnly(true);
+    q.prepare(QSL("SELECT id, date_created, is_read, is_important, contents, feed, title, author, url, custom_id, "
+                  "is_deleted, is_pdeleted "
+                  "FROM Messages "
+                  "WHERE account_id = ? %1 AND %2 IN (%3);")
+                .arg(feed_custom_id.isEmpty() ? QString() : QSL("AND feed = ?"), key_column, placeholders));
+    q.addBindValue(account_id);
+
+    if (!feed_custom_id.isEmpty()) {
+      q.addBindValue(feed_custom_id);
+    }
+
+    for (const QVariant& key : batch_keys) {
+      q.addBindValue(key);
+    }
+
+    QMutexLocker lck(db_mutex);
+
+    if (!q.exec()) {
+      // Articles of this batch would be considered new and inserted again.
+      qCriticalNN << LOGSEC_DB << "Failed to check for existing messages in DB via" << QUOTE_W_SPACE(key_column)
+                  << "with error:" << QUOTE_W_SPACE_DOT(q.lastError().text());
+      *ok = false;
+      return {};
+    }
+
+    while (q.next()) {
+      ExistingArticle art;
+
+      art.m_id = q.value(0).toInt();
+      art.m_created = q.value(1).value<qint64>();
+      art.m_isRead = q.value(2).toBool();
+      art.m_isImportant = q.value(3).toBool();
+      art.m_contents = q.value(4).toString();
+      art.m_feedId = q.value(5).toString();
+      art.m_title = q.value(6).toString();
+      art.m_author = q.value(7).toString();
+      art.m_url = q.value(8).toString();
+      art.m_customId = q.value(9).toString();
+      art.m_isDeleted = q.value(10).toBool();
+      art.m_isPdeleted = q.value(11).toBool();
+
+      existing.append(art);
+    }
+  }
+
+  return existing;
+}
+
 bool DatabaseQueries::purgeMessagesFromBin(const QSqlDatabase& db, bool clear_only_read, int account_id) {
   QSqlQuery q(db);
 
@@ -2029,6 +2327,7 @@ bool DatabaseQueries::deleteAccount(const QSqlDatabase& db, ServiceRoot* account
   QStringList queries;
 
   queries << QSL("DELETE FROM MessageFiltersInFeeds WHERE account_id = :account_id;")
+          << QSL("DELETE FROM LabelsInMessages WHERE account_id = :account_id;")
           << QSL("DELETE FROM Messages WHERE account_id = :account_id;")
           << QSL("DELETE FROM Feeds WHERE account_id = :account_id;")
           << QSL("DELETE FROM Categories WHERE account_id = :account_id;")
@@ -2096,7 +2395,7 @@ bool DatabaseQueries::cleanLabelledMessages(const QSqlDatabase& db, bool clean_r
                   "  is_pdeleted = 0 AND "
                   "  is_read = 1 AND "
                   "  account_id = :account_id AND "
-                  "  labels LIKE :label;"));
+                  "  id IN (SELECT message FROM LabelsInMessages WHERE label = :label AND account_id = :account_id);"));
   }
   else {
     q.prepare(QSL("UPDATE Messages SET is_deleted = :deleted "
@@ -2104,12 +2403,12 @@ bool DatabaseQueries::cleanLabelledMessages(const QSqlDatabase& db, bool clean_r
                   "  is_deleted = 0 AND "
                   "  is_pdeleted = 0 AND "
                   "  account_id = :account_id AND "
-                  "  labels LIKE :label;"));
+                  "  id IN (SELECT message FROM LabelsInMessages WHERE label = :label AND account_id = :account_id);"));
   }
 
   q.bindValue(QSL(":deleted"), 1);
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
-  q.bindValue(QSL(":label"), QSL("%.%1.%").arg(label->customId()));
+  q.bindValue(QSL(":label"), label->customId());
 
   if (!q.exec()) {
     qWarningNN << LOGSEC_DB << "Cleaning of labelled messages failed:" << QUOTE_W_SPACE_DOT(q.lastError().text());
@@ -2132,7 +2431,8 @@ void DatabaseQueries::cleanProbedMessages(const QSqlDatabase& db, bool clean_rea
                   "  is_pdeleted = 0 AND "
                   "  is_read = 1 AND "
                   "  account_id = :account_id AND "
-                  "  (title REGEXP :fltr OR contents REGEXP :fltr);"));
+                  "  %1;")
+                .arg(probeCondition(probe, QSL(":fltr"))));
   }
   else {
     q.prepare(QSL("UPDATE Messages SET is_deleted = :deleted "
@@ -2140,12 +2440,13 @@ void DatabaseQueries::cleanProbedMessages(const QSqlDatabase& db, bool clean_rea
                   "  is_deleted = 0 AND "
                   "  is_pdeleted = 0 AND "
                   "  account_id = :account_id AND "
-                  "  (title REGEXP :fltr OR contents REGEXP :fltr);"));
+                  "  %1;")
+                .arg(probeCondition(probe, QSL(":fltr"))));
   }
 
   q.bindValue(QSL(":deleted"), 1);
   q.bindValue(QSL(":account_id"), probe->getParentServiceRoot()->accountId());
-  q.bindValue(QSL(":fltr"), probe->filter());
+  bindProbeFilter(q, probe);
 
   if (!q.exec()) {
     throw ApplicationException(q.lastError().text());
@@ -2329,9 +2630,9 @@ QStringList DatabaseQueries::customIdsOfMessagesFromLabel(const QSqlDatabase& db
                 "    is_deleted = 0 AND "
                 "    is_pdeleted = 0 AND "
                 "    account_id = :account_id AND "
-                "    labels LIKE :label;"));
+                "    id IN (SELECT message FROM LabelsInMessages WHERE label = :label AND account_id = :account_id);"));
   q.bindValue(QSL(":account_id"), label->getParentServiceRoot()->accountId());
-  q.bindValue(QSL(":label"), QSL("%.%1.%").arg(label->customId()));
+  q.bindValue(QSL(":label"), label->customId());
   q.bindValue(QSL(":read"), target_read == RootItem::ReadStatus::Read ? 0 : 1);
 
   if (ok != nullptr) {
@@ -2357,10 +2658,11 @@ void DatabaseQueries::markProbeReadUnread(const QSqlDatabase& db, Search* probe,
                 "    is_deleted = 0 AND "
                 "    is_pdeleted = 0 AND "
                 "    account_id = :account_id AND "
-                "    (title REGEXP :fltr OR contents REGEXP :fltr);"));
+                "    %1;")
+              .arg(probeCondition(probe, QSL(":fltr"))));
   q.bindValue(QSL(":read"), read == RootItem::ReadStatus::Read ? 1 : 0);
   q.bindValue(QSL(":account_id"), probe->getParentServiceRoot()->accountId());
-  q.bindValue(QSL(":fltr"), probe->filter());
+  bindProbeFilter(q, probe);
 
   if (!q.exec()) {
     throw ApplicationException(q.lastError().text());
@@ -2380,10 +2682,11 @@ QStringList DatabaseQueries::customIdsOfMessagesFromProbe(const QSqlDatabase& db
                 "    is_deleted = 0 AND "
                 "    is_pdeleted = 0 AND "
                 "    account_id = :account_id AND "
-                "    (title REGEXP :fltr OR contents REGEXP :fltr);"));
+                "    %1;")
+              .arg(probeCondition(probe, QSL(":fltr"))));
   q.bindValue(QSL(":account_id"), probe->getParentServiceRoot()->accountId());
   q.bindValue(QSL(":read"), target_read == RootItem::ReadStatus::Read ? 0 : 1);
-  q.bindValue(QSL(":fltr"), probe->filter());
+  bindProbeFilter(q, probe);
 
   if (!q.exec()) {
     throw ApplicationException(q.lastError().text());
@@ -2652,7 +2955,10 @@ void DatabaseQueries::createOverwriteFeed(const QSqlDatabase& db, Feed* feed, in
             "recycle_articles = :recycle_articles, "
             "account_id = :account_id, "
             "custom_id = :custom_id, "
-            "custom_data = :custom_data "
+            "custom_data = :custom_data, "
+            "http_etag = :http_etag, "
+            "http_last_modified = :http_last_modified, "
+            "content_hash = :content_hash "
             "WHERE id = :id;");
   q.bindValue(QSL(":title"), feed->title());
   q.bindValue(QSL(":description"), feed->description());
@@ -2690,6 +2996,42 @@ void DatabaseQueries::createOverwriteFeed(const QSqlDatabase& db, Feed* feed, in
 
   q.bindValue(QSL(":custom_data"), serialized_custom_data);
 
+  const Feed::FetchValidators validators = feed->fetchValidators();
+
+  q.bindValue(QSL(":http_etag"), validators.m_eTag);
+  q.bindValue(QSL(":http_last_modified"), validators.m_lastModified);
+  q.bindValue(QSL(":content_hash"), validators.m_contentHash);
+
+  if (!q.exec()) {
+    throw ApplicationException(q.lastError().text());
+  }
+}
+
+void DatabaseQueries::storeFeedFetchValidators(const QSqlDatabase& db, Feed* feed) {
+  QSqlQuery q(db);
+  const Feed::FetchValidators validators = feed->fetchValidators();
+
+  q.prepare(QSL("UPDATE Feeds "
+                "SET http_etag = :http_etag, http_last_modified = :http_last_modified, content_hash = :content_hash "
+                "WHERE id = :id;"));
+  q.bindValue(QSL(":http_etag"), validators.m_eTag);
+  q.bindValue(QSL(":http_last_modified"), validators.m_lastModified);
+  q.bindValue(QSL(":content_hash"), validators.m_contentHash);
+  q.bindValue(QSL(":id"), feed->id());
+
+  if (!q.exec()) {
+    throw ApplicationException(q.lastError().text());
+  }
+}
+
+void DatabaseQueries::clearFeedFetchValidators(const QSqlDatabase& db, int account_id) {
+  QSqlQuery q(db);
+
+  q.prepare(QSL("UPDATE Feeds "
+                "SET http_etag = NULL, http_last_modified = NULL, content_hash = NULL "
+                "WHERE account_id = :account_id;"));
+  q.bindValue(QSL(":account_id"), account_id);
+
   if (!q.exec()) {
     throw ApplicationException(q.lastError().text());
   }
@@ -17,6 +17,7 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QMultiMap>
+#include <QRegularExpression>
 #include <QSqlError>
 #include <QSqlQuery>
 
@@ -47,18 +48,35 @@ class RSSGUARD_DLLSPEC DatabaseQueries {
     static void deleteProbe(const QSqlDatabase& db, Search* probe);
     static void updateProbe(const QSqlDatabase& db, Search* probe);
 
+    // Returns filters of regular expression probes of the account, keys are IDs of probes.
+    static QHash<int, QString> getRegexProbesForAccount(const QSqlDatabase& db, int account_id);
+    static QList<int> getMessagesMatchingRegex(const QSqlDatabase& db, int account_id, const QRegularExpression& regex);
+
+    // Remembered hits of regular expression probes, pairs are (probe ID, article ID).
+    static void storeProbeHits(const QSqlDatabase& db, int account_id, const QList<QPair<int, int>>& hits);
+    static void removeProbeHits(const QSqlDatabase& db, int probe_id);
+    static void removeProbeHitsOfMessages(const QSqlDatabase& db, const QList<int>& message_ids);
+
+    // Returns SQL condition matching articles of the probe, "fltr" is SQL expression
+    // with the filter, it is used only by full-text probes.
+    static QString probeCondition(const Search* probe, const QString& fltr);
+
     // Message operators.
     static void markProbeReadUnread(const QSqlDatabase& db, Search* probe, RootItem::ReadStatus read);
     static bool markLabelledMessagesReadUnread(const QSqlDatabase& db, Label* label, RootItem::ReadStatus read);
     static bool markImportantMessagesReadUnread(const QSqlDatabase& db, int account_id, RootItem::ReadStatus read);
     static bool markUnreadMessagesRead(const QSqlDatabase& db, int account_id);
     static bool markMessagesReadUnread(const QSqlDatabase& db, const QStringList& ids, RootItem::ReadStatus read);
+
+    // Loads current read/important states of messages which might be outdated.
+    static void refreshMessageStates(const QSqlDatabase& db, QList<Message>& messages);
     static void markMessagesReadUnreadImportant(const QSqlDatabase& db,
                                                 int account_id,
                                                 const QStringList& custom_ids,
                                                 RootItem::ReadStatus read,
                                                 RootItem::Importance important);
     static bool markMessageImportant(const QSqlDatabase& db, int id, RootItem::Importance importance);
+    static void updateMessageContents(const QSqlDatabase& db, const Message& msg);
     static bool markFeedsReadUnread(const QSqlDatabase& db,
                                     const QStringList& ids,
                                     int account_id,
@@ -137,6 +155,9 @@ class RSSGUARD_DLLSPEC DatabaseQueries {
                                            int row_offset,
                                            int row_limit);
 
+    // Loads full contents of given articles, used by article list which only keeps prefix of contents.
+    static QHash<int, QString> getArticlesContents(const QSqlDatabase& db, const QList<int>& ids, bool* ok = nullptr);
+
     // Custom ID accumulators.
     static QStringList bagOfMessages(const QSqlDatabase& db, ServiceRoot::BagOfMessages bag, const Feed* feed);
     static QHash<QString, QStringList> bagsOfMessages(const QSqlDatabase& db, const QList<Label*>& labels);
@@ -194,6 +215,8 @@ class RSSGUARD_DLLSPEC DatabaseQueries {
     static bool cleanFeeds(const QSqlDatabase& db, const QStringList& ids, bool clean_read_only, int account_id);
     static void storeAccountTree(const QSqlDatabase& db, RootItem* tree_root, int account_id);
     static void createOverwriteFeed(const QSqlDatabase& db, Feed* feed, int account_id, int new_parent_id);
+    static void storeFeedFetchValidators(const QSqlDatabase& db, Feed* feed);
+    static void clearFeedFetchValidators(const QSqlDatabase& db, int account_id);
     static void createOverwriteCategory(const QSqlDatabase& db, Category* category, int account_id, int new_parent_id);
     static bool deleteFeed(const QSqlDatabase& db, Feed* feed, int account_id);
     static bool deleteCategory(const QSqlDatabase& db, Category* category);
@@ -233,6 +256,37 @@ class RSSGUARD_DLLSPEC DatabaseQueries {
     static QStringList getAllGmailRecipients(const QSqlDatabase& db, int account_id);
 
   private:
+    // Binds ":fltr" placeholder of probe condition if the probe uses it.
+    static void bindProbeFilter(QSqlQuery& q, const Search* probe);
+
+    // Article already stored in DB, used to detect whether
+    // incoming article is new or changed.
+    struct ExistingArticle {
+        int m_id = -1;
+        qint64 m_created = 0;
+        bool m_isRead = false;
+        bool m_isImportant = false;
+        bool m_isDeleted = false;
+        bool m_isPdeleted = false;
+        QString m_contents;
+        QString m_feedId;
+        QString m_title;
+        QString m_author;
+        QString m_url;
+        QString m_customId;
+    };
+
+    // Fetches existing articles of given account whose "key_column" is in "keys".
+    // Lookups are split into batches so that we do not hit host parameter limits.
+    // If any lookup fails, "ok" is set to false and nothing is returned.
+    static QList<ExistingArticle> existingArticles(const QSqlDatabase& db,
+                                                   const QString& key_column,
+                                                   const QVariantList& keys,
+                                                   int account_id,
+                                                   const QString& feed_custom_id,
+                                                   QMutex* db_mutex,
+                                                   bool* ok);
+
     static QString unnulifyString(const QString& str);
 
     explicit DatabaseQueries() = default;
@@ -408,6 +462,14 @@ Assignment DatabaseQueries::getFeeds(const QSqlDatabase& db,
     feed->setArticleIgnoreLimit(art);
     feed->setOpenArticlesDirectly(query.value(FDS_DB_OPEN_ARTICLES_INDEX).toBool());
 
+    Feed::FetchValidators validators;
+
+    validators.m_eTag = query.value(FDS_DB_HTTP_ETAG_INDEX).toString();
+    validators.m_lastModified = query.value(FDS_DB_HTTP_LAST_MODIFIED_INDEX).toString();
+    validators.m_contentHash = query.value(FDS_DB_CONTENT_HASH_INDEX).toString();
+
+    feed->setFetchValidators(validators);
+
     qDebugNN << LOGSEC_CORE << "Custom ID of feed when loading from DB is" << QUOTE_W_SPACE_DOT(feed->customId());
 
     // Load custom data.
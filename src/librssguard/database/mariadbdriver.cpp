@@ -274,3 +274,13 @@ QString MariaDbDriver::autoIncrementPrimaryKey() const {
 QString MariaDbDriver::blob() const {
   return QSL("MEDIUMBLOB");
 }
+
+QString MariaDbDriver::textIndexPrefix() const {
+  return QSL("(191)");
+}
+
+QString MariaDbDriver::fullTextCondition(const QString& query) const {
+  // Columns must be the same as in FULLTEXT index.
+  return QSL("MATCH (Messages.title, Messages.author, Messages.contents, Messages.url) AGAINST (%1 IN BOOLEAN MODE)")
+    .arg(query);
+}
@@ -43,6 +43,8 @@ class MariaDbDriver : public DatabaseDriver {
                                       DatabaseDriver::DesiredStorageType::FromSettings);
     virtual QString autoIncrementPrimaryKey() const;
     virtual QString blob() const;
+    virtual QString textIndexPrefix() const;
+    virtual QString fullTextCondition(const QString& query) const;
 
     QString interpretErrorCode(MariaDbError error_code) const;
 
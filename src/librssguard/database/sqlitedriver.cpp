@@ -6,14 +6,15 @@
 #include "miscellaneous/application.h"
 
 #include <QDir>
+#include <QElapsedTimer>
 #include <QSqlDriver>
 #include <QSqlError>
 #include <QSqlQuery>
 
-SqliteDriver::SqliteDriver(bool in_memory, QObject* parent)
-  : DatabaseDriver(parent), m_inMemoryDatabase(in_memory),
+SqliteDriver::SqliteDriver(bool in_memory, StorageProfile storage_profile, int cache_size, QObject* parent)
+  : DatabaseDriver(parent), m_inMemoryDatabase(in_memory), m_storageProfile(storage_profile), m_cacheSize(cache_size),
     m_databaseFilePath(qApp->userDataFolder() + QDir::separator() + QSL(APP_DB_SQLITE_PATH)),
-    m_fileBasedDatabaseInitialized(false), m_inMemoryDatabaseInitialized(false) {}
+    m_fileBasedDatabaseInitialized(false), m_inMemoryDatabaseInitialized(false), m_fullTextSearch(false) {}
 
 QString SqliteDriver::location() const {
   return QDir::toNativeSeparators(m_databaseFilePath);
@@ -93,6 +94,10 @@ bool SqliteDriver::saveDatabase() {
   else {
     qDebugNN << LOGSEC_DB << "Saving in-memory working database back to persistent file-based storage.";
 
+    QElapsedTimer tmr;
+
+    tmr.start();
+
     QSqlDatabase database = connection(QSL("SaveFromMemory"), DatabaseDriver::DesiredStorageType::StrictlyInMemory);
     const QDir db_path(m_databaseFilePath);
     QFile db_file(db_path.absoluteFilePath(QSL(APP_DB_SQLITE_FILE)));
@@ -110,6 +115,8 @@ bool SqliteDriver::saveDatabase() {
       }
     }
 
+    qDebugNN << LOGSEC_DB << "Saving in-memory database took" << NONQUOTE_W_SPACE(tmr.elapsed()) << "miliseconds.";
+
     return true;
   }
 }
@@ -159,7 +166,7 @@ QSqlDatabase SqliteDriver::connection(const QString& connection_name, DesiredSto
     QSqlQuery query_db(database);
 
     query_db.setForwardOnly(true);
-    setPragmas(query_db);
+    setPragmas(query_db, want_in_memory);
 
     return database;
   }
@@ -178,8 +185,15 @@ bool SqliteDriver::finishRestoration() {
     qDebugNN << LOGSEC_DB << "Backup database file '" << QDir::toNativeSeparators(backup_database_file)
              << "' was detected. Restoring it.";
 
-    if (IOFactory::copyFile(backup_database_file, m_databaseFilePath + QDir::separator() + APP_DB_SQLITE_FILE)) {
+    const QString database_file = m_databaseFilePath + QDir::separator() + APP_DB_SQLITE_FILE;
+
+    if (IOFactory::copyFile(backup_database_file, database_file)) {
       QFile::remove(backup_database_file);
+
+      // Leftover write-ahead log belongs to the old database.
+      QFile::remove(database_file + QSL("-wal"));
+      QFile::remove(database_file + QSL("-shm"));
+
       qDebugNN << LOGSEC_DB << "Database file was restored successully.";
     }
     else {
@@ -192,6 +206,9 @@ bool SqliteDriver::finishRestoration() {
 }
 
 QSqlDatabase SqliteDriver::initializeDatabase(const QString& connection_name, bool in_memory) {
+  QElapsedTimer tmr;
+
+  tmr.start();
   finishRestoration();
 
   QString db_file_name;
@@ -239,7 +256,14 @@ QSqlDatabase SqliteDriver::initializeDatabase(const QString& connection_name, bo
     QSqlQuery query_db(database);
 
     query_db.setForwardOnly(true);
-    setPragmas(query_db);
+    setPragmas(query_db, in_memory);
+
+    // Some system builds of SQLite come without FTS5.
+    m_fullTextSearch = query_db.exec(QSL("CREATE VIRTUAL TABLE temp.FullTextProbe USING fts5(probe);"));
+
+    if (m_fullTextSearch) {
+      query_db.exec(QSL("DROP TABLE temp.FullTextProbe;"));
+    }
 
     // Sample query which checks for existence of tables.
     if (!query_db.exec(QSL("SELECT inf_value FROM Information WHERE inf_key = 'schema_version'"))) {
@@ -257,6 +281,7 @@ QSqlDatabase SqliteDriver::initializeDatabase(const QString& connection_name, bo
         }
 
         setSchemaVersion(query_db, QSL(APP_DB_SCHEMA_VERSION).toInt(), true);
+        ensureFullTextIndex(query_db);
       }
       catch (const ApplicationException& ex) {
         qFatal("Error when running SQL scripts: %s.", qPrintable(ex.message()));
@@ -287,6 +312,13 @@ QSqlDatabase SqliteDriver::initializeDatabase(const QString& connection_name, bo
         }
       }
 
+      try {
+        ensureFullTextIndex(query_db);
+      }
+      catch (const ApplicationException& ex) {
+        qFatal("Error when creating full-text index: %s.", qPrintable(ex.message()));
+      }
+
       qDebugNN << LOGSEC_DB << "File-based SQLite database connection '" << connection_name << "' to file '"
                << QDir::toNativeSeparators(database.databaseName()) << "' seems to be established.";
       qDebugNN << LOGSEC_DB << "File-based SQLite database has version '" << installed_db_schema << "'.";
@@ -305,10 +337,17 @@ QSqlDatabase SqliteDriver::initializeDatabase(const QString& connection_name, bo
     // Attach database.
     copy_contents.exec(QSL("ATTACH DATABASE '%1' AS 'storage';").arg(file_database.databaseName()));
 
-    // Copy all stuff.
+    // Copy all stuff, including tables which hold full-text index. Triggers of the index
+    // are suspended, so that articles are not tokenized again while they are copied.
     QStringList tables;
 
-    if (copy_contents.exec(QSL("SELECT name FROM storage.sqlite_master WHERE type = 'table';"))) {
+    if (m_fullTextSearch) {
+      dropFullTextTriggers(copy_contents);
+    }
+
+    if (copy_contents.exec(QSL("SELECT name FROM storage.sqlite_master "
+                               "WHERE type = 'table' AND name != 'MessagesSearch'%1;")
+                             .arg(m_fullTextSearch ? QString() : QSL(" AND name NOT LIKE 'MessagesSearch%'")))) {
       while (copy_contents.next()) {
         tables.append(copy_contents.value(0).toString());
       }
@@ -318,7 +357,36 @@ QSqlDatabase SqliteDriver::initializeDatabase(const QString& connection_name, bo
     }
 
     for (const QString& table : tables) {
-      copy_contents.exec(QSL("INSERT INTO main.%1 SELECT * FROM storage.%1;").arg(table));
+      // Columns are listed explicitly because upgraded databases
+      // might have them in different order than fresh ones.
+      QStringList columns;
+
+      if (copy_contents.exec(QSL("PRAGMA storage.table_info(%1);").arg(table))) {
+        while (copy_contents.next()) {
+          columns.append(copy_contents.value(QSL("name")).toString());
+        }
+      }
+
+      if (columns.isEmpty()) {
+        qFatal("Cannot obtain list of columns of table '%s' from file-based SQLite database.", qPrintable(table));
+      }
+
+      if (table.startsWith(QSL("MessagesSearch_"))) {
+        // Freshly created index already has some records.
+        copy_contents.exec(QSL("DELETE FROM main.%1;").arg(table));
+      }
+
+      copy_contents.exec(
+        QSL("INSERT INTO main.%1 (%2) SELECT %2 FROM storage.%1;").arg(table, columns.join(QSL(", "))));
+    }
+
+    if (m_fullTextSearch) {
+      try {
+        createFullTextTriggers(copy_contents);
+      }
+      catch (const ApplicationException& ex) {
+        qFatal("Error when creating full-text index triggers: %s.", qPrintable(ex.message()));
+      }
     }
 
     qDebugNN << LOGSEC_DB << "Copying data from file-based database into working in-memory database.";
@@ -338,6 +406,9 @@ QSqlDatabase SqliteDriver::initializeDatabase(const QString& connection_name, bo
     m_fileBasedDatabaseInitialized = true;
   }
 
+  qDebugNN << LOGSEC_DB << "Initialization of" << (in_memory ? " in-memory" : " file-based")
+           << " SQLite database took" << NONQUOTE_W_SPACE(tmr.elapsed()) << "miliseconds.";
+
   return database;
 }
 
@@ -345,15 +416,31 @@ QString SqliteDriver::databaseFilePath() const {
   return m_databaseFilePath + QDir::separator() + APP_DB_SQLITE_FILE;
 }
 
-void SqliteDriver::setPragmas(QSqlQuery& query) {
+void SqliteDriver::setPragmas(QSqlQuery& query, bool in_memory) {
   query.exec(QSL("PRAGMA encoding = \"UTF-8\""));
   query.exec(QSL("PRAGMA page_size = 32768"));
-  query.exec(QSL("PRAGMA cache_size = 32768"));
-  query.exec(QSL("PRAGMA mmap_size = 100000000"));
   query.exec(QSL("PRAGMA count_changes = OFF"));
   query.exec(QSL("PRAGMA temp_store = MEMORY"));
-  query.exec(QSL("PRAGMA synchronous = OFF"));
-  query.exec(QSL("PRAGMA journal_mode = MEMORY"));
+
+  if (!in_memory && m_storageProfile == StorageProfile::MemoryMapped) {
+    // Pages are read straight from mapped file, cache size is given in kB.
+    query.exec(QSL("PRAGMA mmap_size = %1").arg(SQLITE_DRIVER_MMAP_SIZE));
+    query.exec(QSL("PRAGMA cache_size = -%1").arg(m_cacheSize * 1024));
+  }
+  else {
+    query.exec(QSL("PRAGMA cache_size = 32768"));
+    query.exec(QSL("PRAGMA mmap_size = 100000000"));
+  }
+
+  if (!in_memory && m_storageProfile != StorageProfile::Fast) {
+    // Readers do not block the writer and only checkpoints wait for the disk.
+    query.exec(QSL("PRAGMA journal_mode = WAL"));
+    query.exec(QSL("PRAGMA synchronous = NORMAL"));
+  }
+  else {
+    query.exec(QSL("PRAGMA synchronous = OFF"));
+    query.exec(QSL("PRAGMA journal_mode = MEMORY"));
+  }
 }
 
 qint64 SqliteDriver::databaseDataSize() {
@@ -393,6 +480,13 @@ void SqliteDriver::backupDatabase(const QString& backup_folder, const QString& b
 
   saveDatabase();
 
+  if (!m_inMemoryDatabase && m_storageProfile != StorageProfile::Fast) {
+    // Copied file must contain also changes still waiting in write-ahead log.
+    QSqlQuery query(connection(metaObject()->className(), DatabaseDriver::DesiredStorageType::StrictlyFileBased));
+
+    query.exec(QSL("PRAGMA wal_checkpoint(TRUNCATE)"));
+  }
+
   if (!IOFactory::copyFile(databaseFilePath(),
                            backup_folder + QDir::separator() + backup_name + BACKUP_SUFFIX_DATABASE)) {
     throw ApplicationException(tr("Database file not copied to output directory successfully."));
@@ -406,3 +500,63 @@ QString SqliteDriver::autoIncrementPrimaryKey() const {
 QString SqliteDriver::blob() const {
   return QSL("BLOB");
 }
+
+QString SqliteDriver::textIndexPrefix() const {
+  return QString();
+}
+
+QString SqliteDriver::fullTextCondition(const QString& query) const {
+  if (!m_fullTextSearch) {
+    // Without full-text index the whole query is searched as plain text.
+    return QSL("(Messages.title LIKE '%' || %1 || '%' OR Messages.author LIKE '%' || %1 || '%' OR "
+               "Messages.contents LIKE '%' || %1 || '%' OR Messages.url LIKE '%' || %1 || '%')")
+      .arg(query);
+  }
+
+  return QSL("Messages.id IN (SELECT rowid FROM MessagesSearch WHERE MessagesSearch MATCH %1)").arg(query);
+}
+
+void SqliteDriver::ensureFullTextIndex(QSqlQuery& query) {
+  if (!m_fullTextSearch) {
+    qWarningNN << LOGSEC_DB << "SQLite is built without FTS5, full-text queries fall back to plain text search.";
+
+    // Database might come from SQLite build with FTS5.
+    dropFullTextTriggers(query);
+    return;
+  }
+
+  if (query.exec(QSL("SELECT COUNT(*) FROM sqlite_master WHERE type = 'trigger' AND name LIKE 'MessagesSearch_%';")) &&
+      query.next() && query.value(0).toInt() == 3) {
+    return;
+  }
+
+  qDebugNN << LOGSEC_DB << "Creating full-text index of articles.";
+
+  // Index without triggers is out of date, so it is created again.
+  dropFullTextTriggers(query);
+  query.exec(QSL("DROP TABLE IF EXISTS MessagesSearch;"));
+
+  const QStringList statements = prepareScript(APP_SQL_PATH, QSL(APP_DB_SQLITE_SEARCH));
+
+  for (const QString& statement : statements) {
+    if (!query.exec(statement) && query.lastError().isValid()) {
+      throw ApplicationException(query.lastError().text());
+    }
+  }
+}
+
+void SqliteDriver::createFullTextTriggers(QSqlQuery& query) {
+  const QStringList statements = prepareScript(APP_SQL_PATH, QSL(APP_DB_SQLITE_SEARCH_TRIGGERS));
+
+  for (const QString& statement : statements) {
+    if (!query.exec(statement) && query.lastError().isValid()) {
+      throw ApplicationException(query.lastError().text());
+    }
+  }
+}
+
+void SqliteDriver::dropFullTextTriggers(QSqlQuery& query) {
+  query.exec(QSL("DROP TRIGGER IF EXISTS MessagesSearch_insert;"));
+  query.exec(QSL("DROP TRIGGER IF EXISTS MessagesSearch_delete;"));
+  query.exec(QSL("DROP TRIGGER IF EXISTS MessagesSearch_update;"));
+}
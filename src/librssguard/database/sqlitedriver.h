@@ -11,11 +11,29 @@
 #include "3rd-party/sqlite/sqlite3.h"
 #endif
 
+#define SQLITE_DRIVER_MMAP_SIZE 2147418112 // Largest mapping allowed by default SQLite build.
+
 class SqliteDriver : public DatabaseDriver {
     Q_OBJECT
 
   public:
-    explicit SqliteDriver(bool in_memory, QObject* parent = nullptr);
+    // How file-based database trades speed for safety of data.
+    enum class StorageProfile {
+      // Journal is kept in memory and nothing is synced, crash might corrupt DB.
+      Fast = 0,
+
+      // Write-ahead log synced on checkpoints, crash loses at most last transactions.
+      WriteAheadLog = 1,
+
+      // Write-ahead log with DB file mapped to memory and configurable page cache,
+      // reads are about as fast as with in-memory DB without copying it on startup.
+      MemoryMapped = 2
+    };
+
+    explicit SqliteDriver(bool in_memory,
+                          StorageProfile storage_profile,
+                          int cache_size,
+                          QObject* parent = nullptr);
 
     virtual QString location() const;
     virtual DriverType driverType() const;
@@ -33,10 +51,19 @@ class SqliteDriver : public DatabaseDriver {
     virtual void backupDatabase(const QString& backup_folder, const QString& backup_name);
     virtual QString autoIncrementPrimaryKey() const;
     virtual QString blob() const;
+    virtual QString textIndexPrefix() const;
+    virtual QString fullTextCondition(const QString& query) const;
 
   private:
     QSqlDatabase initializeDatabase(const QString& connection_name, bool in_memory);
-    void setPragmas(QSqlQuery& query);
+    void setPragmas(QSqlQuery& query, bool in_memory);
+
+    // Creates and fills full-text index of articles if SQLite supports it
+    // and the index does not exist yet. Without FTS5, triggers of the index
+    // are dropped as they would make every change of articles fail.
+    void ensureFullTextIndex(QSqlQuery& query);
+    void createFullTextTriggers(QSqlQuery& query);
+    void dropFullTextTriggers(QSqlQuery& query);
     QString databaseFilePath() const;
 
     // Uses native "sqlite3" handle to save or load in-memory DB from/to file.
@@ -44,9 +71,14 @@ class SqliteDriver : public DatabaseDriver {
 
   private:
     bool m_inMemoryDatabase;
+    StorageProfile m_storageProfile;
+    int m_cacheSize;
     QString m_databaseFilePath;
     bool m_fileBasedDatabaseInitialized;
     bool m_inMemoryDatabaseInitialized;
+
+    // SQLite is built with FTS5 and articles have full-text index.
+    bool m_fullTextSearch;
 };
 
 #endif // SQLITEDRIVER_H
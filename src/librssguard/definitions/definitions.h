@@ -58,6 +58,8 @@
 #define IS_IN_ARRAY(offset, array)  ((offset >= 0) && (offset < array.count()))
 #define DEFAULT_SQL_MESSAGES_FILTER "0 > 1"
 #define MAX_MULTICOLUMN_SORT_STATES 3
+#define MSG_LIST_WINDOW_ROWS        1024
+#define MSG_LIST_CONTENTS_PREFIX    128
 
 #define RELEASES_LIST      "https://api.github.com/repos/martinrotter/rssguard/releases"
 #define MSG_FILTERING_HELP APP_URL_DOCUMENTATION "#fltr"
@@ -95,12 +97,13 @@
 #define MIME_TYPE_ITEM_POINTER       "rssguard/itempointer"
 #define DOWNLOADER_ICON_SIZE         48
 #define ENCRYPTION_FILE_NAME         "key.private"
-#define RELOAD_MODEL_BORDER_NUM      10
 #define COOKIE_URL_IDENTIFIER        ":COOKIE:"
 #define DEFAULT_NOTIFICATION_VOLUME  50
 #define MAX_THREADPOOL_THREADS       32
 #define WEB_BROWSER_SCROLL_STEP      50.0
 #define MAX_NUMBER_OF_REDIRECTIONS   4
+#define DB_BULK_LOOKUP_SIZE          500
+#define DB_BULK_INSERT_ROWS          64 // Keeps bound parameters of single INSERT below 999.
 
 #define NOTIFICATIONS_MARGIN       16
 #define NOTIFICATIONS_WIDTH        300
@@ -154,7 +157,9 @@
 
 #define CLI_THREADS "threads"
 
-#define HTTP_CODE_NOT_MODIFIED 304
+#define HTTP_CODE_NOT_MODIFIED      304
+#define HTTP_CODE_TOO_MANY_REQUESTS 429
+#define HTTP_CODE_UNAVAILABLE       503
 
 #define HTTP_HEADERS_ACCEPT         "Accept"
 #define HTTP_HEADERS_CONTENT_TYPE   "Content-Type"
@@ -162,6 +167,7 @@
 #define HTTP_HEADERS_AUTHORIZATION  "Authorization"
 #define HTTP_HEADERS_USER_AGENT     "User-Agent"
 #define HTTP_HEADERS_COOKIE         "Cookie"
+#define HTTP_HEADERS_RETRY_AFTER    "retry-after"
 
 #define LOGSEC_NETWORK        "network: "
 #define LOGSEC_ADBLOCK        "adblock: "
@@ -223,19 +229,22 @@
 #define APP_DB_MYSQL_TEST   "MySQLTest"
 #define APP_DB_MYSQL_PORT   3306
 
-#define APP_DB_SQLITE_DRIVER "QSQLITE"
-#define APP_DB_SQLITE_INIT   "db_init_sqlite.sql"
-#define APP_DB_SQLITE_PATH   "database"
-#define APP_DB_SQLITE_FILE   "database.db"
+#define APP_DB_SQLITE_DRIVER          "QSQLITE"
+#define APP_DB_SQLITE_INIT            "db_init_sqlite.sql"
+#define APP_DB_SQLITE_SEARCH          "db_search_sqlite.sql"
+#define APP_DB_SQLITE_SEARCH_TRIGGERS "db_search_triggers_sqlite.sql"
+#define APP_DB_SQLITE_PATH            "database"
+#define APP_DB_SQLITE_FILE            "database.db"
 
 // Keep this in sync with schema versions declared in SQL initialization code.
-#define APP_DB_SCHEMA_VERSION                "8"
+#define APP_DB_SCHEMA_VERSION                "13"
 #define APP_DB_UPDATE_FILE_PATTERN           "db_update_%1_%2_%3.sql"
 #define APP_DB_COMMENT_SPLIT                 "-- !\n"
 #define APP_DB_INCLUDE_PLACEHOLDER           "!!"
 #define APP_DB_NAME_PLACEHOLDER              "##"
 #define APP_DB_AUTO_INC_PRIM_KEY_PLACEHOLDER "$$"
 #define APP_DB_BLOB_PLACEHOLDER              "^^"
+#define APP_DB_TEXT_INDEX_PLACEHOLDER        "@@"
 
 #define APP_CFG_PATH "config"
 #define APP_CFG_FILE "config.ini"
@@ -332,6 +341,9 @@
 #define FDS_DB_ACCOUNT_ID_INDEX                21
 #define FDS_DB_CUSTOM_ID_INDEX                 22
 #define FDS_DB_CUSTOM_DATA_INDEX               23
+#define FDS_DB_HTTP_ETAG_INDEX                 24
+#define FDS_DB_HTTP_LAST_MODIFIED_INDEX        25
+#define FDS_DB_CONTENT_HASH_INDEX              26
 
 // Indexes of columns for feed models.
 #define FDS_MODEL_TITLE_INDEX  0
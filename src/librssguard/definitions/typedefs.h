@@ -22,6 +22,16 @@ struct ArticleCounts {
 struct UpdatedArticles {
     QList<Message> m_unread;
     QList<Message> m_all;
+
+    // Changes of article counts caused by the update, they allow
+    // to adjust counts of items without recounting them in DB.
+    ArticleCounts m_feedCountsDelta = {0, 0};
+    ArticleCounts m_importantCountsDelta = {0, 0};
+    ArticleCounts m_binCountsDelta = {0, 0};
+
+    // Deltas are not usable if some article was moved between feeds.
+    bool m_countsDeltaValid = true;
+    bool m_labelsChanged = false;
 };
 
 struct IconLocation {
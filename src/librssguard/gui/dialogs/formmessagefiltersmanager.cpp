@@ -479,7 +479,29 @@ void FormMessageFiltersManager::processCheckedFeeds() {
       }
 
       // Update messages in DB and reload selection.
-      it->getParentServiceRoot()->updateMessages(msgs, it->toFeed(), true, nullptr);
+      QSqlDatabase database =
+        qApp->database()->driver()->threadSafeConnection(it->getParentServiceRoot()->metaObject()->className());
+      const bool in_transaction = database.transaction();
+
+      try {
+        it->getParentServiceRoot()->updateMessages(msgs, it->toFeed(), true, nullptr);
+      }
+      catch (const ApplicationException& ex) {
+        qCriticalNN << LOGSEC_CORE << "Failed to store filtered messages:" << QUOTE_W_SPACE_DOT(ex.message());
+
+        if (in_transaction) {
+          database.rollback();
+        }
+
+        return;
+      }
+
+      if (in_transaction && !database.commit()) {
+        qCriticalNN << LOGSEC_CORE
+                    << "Failed to commit filtered messages:" << QUOTE_W_SPACE_DOT(database.lastError().text());
+        database.rollback();
+      }
+
       displayMessagesOfFeed();
     }
   }
@@ -554,6 +576,7 @@ void FormMessageFiltersManager::showFilter(MessageFilter* filter) {
   if (filter == nullptr) {
     m_ui.m_txtTitle->clear();
     m_ui.m_txtScript->clear();
+    m_ui.m_lblStatistics->clear();
     m_ui.m_gbDetails->setEnabled(false);
 
     m_ui.m_treeFeeds->setEnabled(false);
@@ -564,6 +587,7 @@ void FormMessageFiltersManager::showFilter(MessageFilter* filter) {
   else {
     m_ui.m_txtTitle->setText(filter->name());
     m_ui.m_txtScript->setPlainText(filter->script());
+    m_ui.m_lblStatistics->setText(filterStatistics(filter));
     m_ui.m_gbDetails->setEnabled(true);
 
     m_ui.m_treeFeeds->setEnabled(true);
@@ -577,6 +601,22 @@ void FormMessageFiltersManager::showFilter(MessageFilter* filter) {
   m_loadingFilter = false;
 }
 
+QString FormMessageFiltersManager::filterStatistics(MessageFilter* filter) const {
+  const qint64 runs = filter->executionsCount();
+
+  if (runs <= 0) {
+    return tr("Filter did not run during fetching of articles yet.");
+  }
+
+  const qint64 time = filter->executionTime();
+
+  return tr("Filter ran %n time(s) during fetching of articles, it took %1 ms in total "
+            "and %2 microseconds on average.",
+            nullptr,
+            int(runs))
+    .arg(QString::number(time / 1000), QString::number(time / runs));
+}
+
 void FormMessageFiltersManager::loadAccounts() {
   for (auto* acc : std::as_const(m_accounts)) {
     m_ui.m_cmbAccounts->addItem(acc->icon(), acc->title(), QVariant::fromValue(acc));
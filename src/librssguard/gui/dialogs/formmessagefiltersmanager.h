@@ -64,6 +64,7 @@ class FormMessageFiltersManager : public QDialog {
 
     RootItem* selectedCategoryFeed() const;
     Message testingMessage() const;
+    QString filterStatistics(MessageFilter* filter) const;
 
   private:
     Ui::FormMessageFiltersManager m_ui;
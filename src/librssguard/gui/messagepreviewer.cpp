@@ -3,6 +3,7 @@
 #include "gui/messagepreviewer.h"
 
 #include "database/databasequeries.h"
+#include "exceptions/applicationexception.h"
 #include "gui/itemdetails.h"
 #include "gui/webbrowser.h"
 #include "miscellaneous/application.h"
@@ -203,8 +204,26 @@ void MessagePreviewer::markMessageAsUnread() {
   markMessageAsReadUnread(RootItem::ReadStatus::Unread);
 }
 
+bool MessagePreviewer::refreshMessageStates() {
+  QList<Message> msgs = {m_message};
+
+  try {
+    DatabaseQueries::refreshMessageStates(qApp->database()->driver()->connection(objectName()), msgs);
+    m_message = msgs.first();
+    return true;
+  }
+  catch (const ApplicationException& ex) {
+    qWarningNN << LOGSEC_GUI << "Cannot load current states of article:" << QUOTE_W_SPACE_DOT(ex.message());
+    return false;
+  }
+}
+
 void MessagePreviewer::markMessageAsReadUnread(RootItem::ReadStatus read) {
   if (!m_root.isNull()) {
+    if (!refreshMessageStates()) {
+      return;
+    }
+
     if (m_root->getParentServiceRoot()->onBeforeSetMessagesRead(m_root.data(), QList<Message>() << m_message, read)) {
       DatabaseQueries::markMessagesReadUnread(qApp->database()
                                                 ->driver()
@@ -223,6 +242,15 @@ void MessagePreviewer::markMessageAsReadUnread(RootItem::ReadStatus read) {
 
 void MessagePreviewer::switchMessageImportance(bool checked) {
   if (!m_root.isNull()) {
+    if (!refreshMessageStates()) {
+      return;
+    }
+
+    if (m_message.m_isImportant == checked) {
+      updateButtons();
+      return;
+    }
+
     if (m_root->getParentServiceRoot()
           ->onBeforeSwitchMessageImportance(m_root.data(),
                                             QList<ImportanceChange>()
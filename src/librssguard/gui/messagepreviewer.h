@@ -68,6 +68,9 @@ class MessagePreviewer : public TabContent {
     void updateButtons();
     void updateLabels(bool only_clear);
 
+    // Displayed message might be outdated, loads its current states from DB.
+    bool refreshMessageStates();
+
     void ensureItemDetailsVisible();
     void ensureDefaultBrowserVisible();
 
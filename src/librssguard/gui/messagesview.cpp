@@ -486,7 +486,7 @@ void MessagesView::mousePressEvent(QMouseEvent* event) {
 
       if (clicked_index.isValid()) {
         const QModelIndex mapped_index = m_proxyModel->mapToSource(clicked_index);
-        const QString url = m_sourceModel->messageAt(mapped_index.row()).m_url;
+        const QString url = m_sourceModel->messageAt(mapped_index.row(), false).m_url;
 
         if (!url.isEmpty()) {
           qApp->mainForm()->tabWidget()->addLinkedBrowser(url);
@@ -610,7 +610,7 @@ void MessagesView::openSelectedSourceMessagesExternally() {
   auto rws = selectionModel()->selectedRows();
 
   for (const QModelIndex& index : std::as_const(rws)) {
-    QString link = m_sourceModel->messageAt(m_proxyModel->mapToSource(index).row())
+    QString link = m_sourceModel->messageAt(m_proxyModel->mapToSource(index).row(), false)
                      .m_url.replace(QRegularExpression(QSL("[\\t\\n]")), QString());
 
     qApp->web()->openUrlInExternalBrowser(link);
@@ -635,7 +635,7 @@ void MessagesView::playSelectedArticleInMediaPlayer() {
   auto rws = selectionModel()->selectedRows();
 
   if (!rws.isEmpty()) {
-    auto msg = m_sourceModel->messageAt(m_proxyModel->mapToSource(rws.first()).row());
+    auto msg = m_sourceModel->messageAt(m_proxyModel->mapToSource(rws.first()).row(), false);
 
     if (msg.m_url.isEmpty()) {
       qApp->showGuiMessage(Notification::Event::GeneralEvent,
@@ -665,7 +665,7 @@ void MessagesView::openSelectedMessageUrl() {
   auto rws = selectionModel()->selectedRows();
 
   if (!rws.isEmpty()) {
-    auto msg = m_sourceModel->messageAt(m_proxyModel->mapToSource(rws.at(0)).row());
+    auto msg = m_sourceModel->messageAt(m_proxyModel->mapToSource(rws.at(0)).row(), false);
 
     if (!msg.m_url.isEmpty()) {
       emit openLinkMiniBrowser(msg.m_url);
@@ -838,7 +838,45 @@ void MessagesView::searchMessages(SearchLineEdit::SearchMode mode,
                                   const QString& phrase) {
   qDebugNN << LOGSEC_GUI << "Running search of messages with pattern" << QUOTE_W_SPACE_DOT(phrase);
 
+  const bool full_text = mode == SearchLineEdit::SearchMode::FullText;
+  const QString full_text_query = full_text ? phrase.simplified() : QString();
+  const MessagesToolBar::SearchFields where_search = MessagesToolBar::SearchFields(custom_criteria);
+  bool reload = false;
+
+  if (full_text_query != m_sourceModel->fullTextQuery()) {
+    // Full-text query is answered by DB index, so list
+    // is reloaded and only matching articles are loaded.
+    m_sourceModel->setFullTextQuery(full_text_query);
+    reload = true;
+  }
+
+  if (m_sourceModel->windowedArticleList()) {
+    // Prefix of contents is not enough when searching in all columns,
+    // so full contents are loaded for the time of the search.
+    const bool search_contents =
+      !phrase.isEmpty() && !full_text && where_search != MessagesToolBar::SearchFields::SearchTitleOnly;
+    const int contents_prefix = search_contents ? 0 : MSG_LIST_CONTENTS_PREFIX;
+
+    if (contents_prefix != m_sourceModel->contentsPrefixLength()) {
+      m_sourceModel->setContentsPrefixLength(contents_prefix);
+      reload = true;
+    }
+  }
+
+  if (reload) {
+    reloadSelections();
+  }
+
+  if (!phrase.isEmpty() && !full_text) {
+    // Search must see all articles, not only those loaded so far.
+    m_sourceModel->fetchAllData();
+  }
+
   switch (mode) {
+    case SearchLineEdit::SearchMode::FullText:
+      m_proxyModel->setFilterFixedString(QString());
+      break;
+
     case SearchLineEdit::SearchMode::Wildcard:
       m_proxyModel->setFilterWildcard(phrase);
       break;
@@ -854,9 +892,6 @@ void MessagesView::searchMessages(SearchLineEdit::SearchMode mode,
   }
 
   m_proxyModel->setFilterCaseSensitivity(sensitivity);
-
-  MessagesToolBar::SearchFields where_search = MessagesToolBar::SearchFields(custom_criteria);
-
   m_proxyModel->setFilterKeyColumn(where_search == MessagesToolBar::SearchFields::SearchTitleOnly ? MSG_DB_TITLE_INDEX
                                                                                                   : -1);
 
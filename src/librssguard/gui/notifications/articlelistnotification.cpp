@@ -4,6 +4,7 @@
 
 #include "core/articlelistnotificationmodel.h"
 #include "database/databasequeries.h"
+#include "exceptions/applicationexception.h"
 #include "miscellaneous/iconfactory.h"
 #include "network-web/webfactory.h"
 
@@ -145,8 +146,9 @@ void ArticleListNotification::markAllRead() {
   emit reloadMessageListRequested(false);
 }
 
-void ArticleListNotification::markAsRead(Feed* feed, const QList<Message>& articles) {
+void ArticleListNotification::markAsRead(Feed* feed, QList<Message> articles) {
   ServiceRoot* acc = feed->getParentServiceRoot();
+  auto db = qApp->database()->driver()->connection(metaObject()->className());
   QStringList message_ids;
   message_ids.reserve(articles.size());
 
@@ -155,9 +157,17 @@ void ArticleListNotification::markAsRead(Feed* feed, const QList<Message>& artic
     message_ids.append(QString::number(message.m_id));
   }
 
-  if (acc->onBeforeSetMessagesRead(feed, articles, RootItem::ReadStatus::Read)) {
-    auto db = qApp->database()->driver()->connection(metaObject()->className());
+  try {
+    // User might have read some of the articles in the meantime, counts are
+    // adjusted from current states.
+    DatabaseQueries::refreshMessageStates(db, articles);
+  }
+  catch (const ApplicationException& ex) {
+    qWarningNN << LOGSEC_GUI << "Cannot load current states of articles:" << QUOTE_W_SPACE_DOT(ex.message());
+    return;
+  }
 
+  if (acc->onBeforeSetMessagesRead(feed, articles, RootItem::ReadStatus::Read)) {
     if (DatabaseQueries::markMessagesReadUnread(db, message_ids, RootItem::ReadStatus::Read)) {
       acc->onAfterSetMessagesRead(feed, articles, RootItem::ReadStatus::Read);
     }
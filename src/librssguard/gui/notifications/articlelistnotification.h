@@ -34,7 +34,7 @@ class ArticleListNotification : public BaseToastNotification {
     void markAllRead();
 
   private:
-    void markAsRead(Feed* feed, const QList<Message>& articles);
+    void markAsRead(Feed* feed, QList<Message> articles);
 
     Feed* selectedFeed(int index = -1) const;
     Message selectedMessage() const;
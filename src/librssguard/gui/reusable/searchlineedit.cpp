@@ -11,7 +11,8 @@
 #include <QTimer>
 #include <QWidgetAction>
 
-SearchLineEdit::SearchLineEdit(const QList<CustomSearchChoice>& choices, QWidget* parent) : BaseLineEdit(parent) {
+SearchLineEdit::SearchLineEdit(const QList<CustomSearchChoice>& choices, bool with_full_text, QWidget* parent)
+  : BaseLineEdit(parent) {
   QWidgetAction* act = new QWidgetAction(this);
   PlainToolButton* btn = new PlainToolButton(this);
 
@@ -42,7 +43,13 @@ SearchLineEdit::SearchLineEdit(const QList<CustomSearchChoice>& choices, QWidget
   addAction(act, QLineEdit::ActionPosition::LeadingPosition);
 
   // Load predefined modes.
-  for (SearchMode mode : {SearchMode::FixedString, SearchMode::Wildcard, SearchMode::RegularExpression}) {
+  QList<SearchMode> modes = {SearchMode::FixedString, SearchMode::Wildcard, SearchMode::RegularExpression};
+
+  if (with_full_text) {
+    modes.append(SearchMode::FullText);
+  }
+
+  for (SearchMode mode : std::as_const(modes)) {
     QAction* ac = m_actionGroupModes->addAction(m_menu->addAction(titleForMode(mode)));
 
     ac->setCheckable(true);
@@ -106,6 +113,9 @@ QString SearchLineEdit::titleForMode(SearchMode mode) {
     case SearchLineEdit::SearchMode::RegularExpression:
       return tr("Regular expression");
 
+    case SearchLineEdit::SearchMode::FullText:
+      return tr("Full-text query");
+
     default:
       return {};
   }
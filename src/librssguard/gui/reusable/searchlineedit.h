@@ -22,10 +22,13 @@ class SearchLineEdit : public BaseLineEdit {
     enum class SearchMode {
       FixedString = 1,
       Wildcard = 2,
-      RegularExpression = 4
+      RegularExpression = 4,
+
+      // Phrase is query for full-text index of database.
+      FullText = 8
     };
 
-    explicit SearchLineEdit(const QList<CustomSearchChoice>& choices, QWidget* parent = nullptr);
+    explicit SearchLineEdit(const QList<CustomSearchChoice>& choices, bool with_full_text, QWidget* parent = nullptr);
 
   private slots:
     void startSearch();
@@ -4,6 +4,7 @@
 
 #include "database/databasefactory.h"
 #include "database/mariadbdriver.h"
+#include "database/sqlitedriver.h"
 #include "definitions/definitions.h"
 #include "miscellaneous/application.h"
 #include "miscellaneous/iconfactory.h"
@@ -35,9 +36,19 @@ SettingsDatabase::SettingsDatabase(Settings* settings, QWidget* parent)
                      " • application startup and shutdown can take little longer "
                      "(max. 2 seconds).\n"
                      "\n"
+                     "Memory-mapped storage profile offers similar reading speed "
+                     "without these disadvantages.\n"
+                     "\n"
                      "Authors of this application are NOT responsible for lost data."),
                   true);
 
+  m_ui->m_cmbSqliteStorageProfile->addItem(tr("Fast (data might be lost on crash)"),
+                                           int(SqliteDriver::StorageProfile::Fast));
+  m_ui->m_cmbSqliteStorageProfile->addItem(tr("Write-ahead log (crash-safe)"),
+                                           int(SqliteDriver::StorageProfile::WriteAheadLog));
+  m_ui->m_cmbSqliteStorageProfile->addItem(tr("Memory-mapped write-ahead log (crash-safe, fast reads)"),
+                                           int(SqliteDriver::StorageProfile::MemoryMapped));
+
   m_ui->m_txtMysqlPassword->lineEdit()->setPasswordMode(true);
 
   connect(m_ui->m_cmbDatabaseDriver,
@@ -45,6 +56,22 @@ SettingsDatabase::SettingsDatabase(Settings* settings, QWidget* parent)
           this,
           &SettingsDatabase::dirtifySettings);
   connect(m_ui->m_checkSqliteUseInMemoryDatabase, &QCheckBox::toggled, this, &SettingsDatabase::dirtifySettings);
+  connect(m_ui->m_checkSqliteUseInMemoryDatabase,
+          &QCheckBox::toggled,
+          this,
+          &SettingsDatabase::updateSqliteStorageControls);
+  connect(m_ui->m_cmbSqliteStorageProfile,
+          static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
+          this,
+          &SettingsDatabase::dirtifySettings);
+  connect(m_ui->m_cmbSqliteStorageProfile,
+          static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
+          this,
+          &SettingsDatabase::updateSqliteStorageControls);
+  connect(m_ui->m_spinSqliteCacheSize,
+          static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged),
+          this,
+          &SettingsDatabase::dirtifySettings);
   connect(m_ui->m_txtMysqlDatabase->lineEdit(), &QLineEdit::textChanged, this, &SettingsDatabase::dirtifySettings);
   connect(m_ui->m_txtMysqlHostname->lineEdit(), &QLineEdit::textChanged, this, &SettingsDatabase::dirtifySettings);
   connect(m_ui->m_txtMysqlPassword->lineEdit(), &QLineEdit::textChanged, this, &SettingsDatabase::dirtifySettings);
@@ -79,6 +106,11 @@ SettingsDatabase::SettingsDatabase(Settings* settings, QWidget* parent)
           this,
           &SettingsDatabase::requireRestart);
   connect(m_ui->m_checkSqliteUseInMemoryDatabase, &QCheckBox::toggled, this, &SettingsDatabase::requireRestart);
+  connect(m_ui->m_cmbSqliteStorageProfile,
+          static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
+          this,
+          &SettingsDatabase::requireRestart);
+  connect(m_ui->m_spinSqliteCacheSize, &QSpinBox::editingFinished, this, &SettingsDatabase::requireRestart);
   connect(m_ui->m_spinMysqlPort, &QSpinBox::editingFinished, this, &SettingsDatabase::requireRestart);
   connect(m_ui->m_txtMysqlHostname->lineEdit(), &BaseLineEdit::textEdited, this, &SettingsDatabase::requireRestart);
   connect(m_ui->m_txtMysqlPassword->lineEdit(), &BaseLineEdit::textEdited, this, &SettingsDatabase::requireRestart);
@@ -164,6 +196,16 @@ void SettingsDatabase::selectSqlBackend(int index) {
   }
 }
 
+void SettingsDatabase::updateSqliteStorageControls() {
+  // In-memory database is never synced to disk until it is saved.
+  const bool file_based = !m_ui->m_checkSqliteUseInMemoryDatabase->isChecked();
+  const bool memory_mapped = m_ui->m_cmbSqliteStorageProfile->currentData().toInt() ==
+                             int(SqliteDriver::StorageProfile::MemoryMapped);
+
+  m_ui->m_cmbSqliteStorageProfile->setEnabled(file_based);
+  m_ui->m_spinSqliteCacheSize->setEnabled(file_based && memory_mapped);
+}
+
 void SettingsDatabase::loadSettings() {
   onBeginLoadSettings();
   m_ui->m_lblMysqlTestResult->setStatus(WidgetWithStatus::StatusType::Information,
@@ -178,6 +220,10 @@ void SettingsDatabase::loadSettings() {
   // Load in-memory database status.
   m_ui->m_checkSqliteUseInMemoryDatabase
     ->setChecked(settings()->value(GROUP(Database), SETTING(Database::UseInMemory)).toBool());
+  m_ui->m_cmbSqliteStorageProfile->setCurrentIndex(m_ui->m_cmbSqliteStorageProfile->findData(
+    settings()->value(GROUP(Database), SETTING(Database::SqliteStorageProfile)).toInt()));
+  m_ui->m_spinSqliteCacheSize->setValue(settings()->value(GROUP(Database), SETTING(Database::SqliteCacheSize)).toInt());
+  updateSqliteStorageControls();
 
   auto* mysq_driver = qApp->database()->driverForType(DatabaseDriver::DriverType::MySQL);
 
@@ -230,6 +276,10 @@ void SettingsDatabase::saveSettings() {
 
   // Save SQLite.
   settings()->setValue(GROUP(Database), Database::UseInMemory, new_inmemory);
+  settings()->setValue(GROUP(Database),
+                       Database::SqliteStorageProfile,
+                       m_ui->m_cmbSqliteStorageProfile->currentData().toInt());
+  settings()->setValue(GROUP(Database), Database::SqliteCacheSize, m_ui->m_spinSqliteCacheSize->value());
 
   if (QSqlDatabase::isDriverAvailable(QSL(APP_DB_MYSQL_DRIVER))) {
     // Save MySQL.
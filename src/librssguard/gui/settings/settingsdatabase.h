@@ -26,6 +26,7 @@ class SettingsDatabase : public SettingsPanel {
     void onMysqlPasswordChanged(const QString& new_password);
     void onMysqlDatabaseChanged(const QString& new_database);
     void selectSqlBackend(int index);
+    void updateSqliteStorageControls();
 
     Ui::SettingsDatabase* m_ui;
 };
@@ -12,6 +12,8 @@
 #include "miscellaneous/feedreader.h"
 #include "miscellaneous/settings.h"
 #include "miscellaneous/textfactory.h"
+#include "network-web/resourcecache.h"
+#include "network-web/webfactory.h"
 
 #include <QFontDialog>
 #include <QLocale>
@@ -63,6 +65,18 @@ SettingsFeedsMessages::SettingsFeedsMessages(Settings* settings, QWidget* parent
           static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged),
           this,
           &SettingsFeedsMessages::dirtifySettings);
+  connect(m_ui->m_spinResourcesDownloadsPerHost,
+          QOverload<int>::of(&QSpinBox::valueChanged),
+          this,
+          &SettingsFeedsMessages::dirtifySettings);
+  connect(m_ui->m_spinResourcesCacheSize,
+          QOverload<int>::of(&QSpinBox::valueChanged),
+          this,
+          &SettingsFeedsMessages::dirtifySettings);
+  connect(m_ui->m_btnClearResourcesCache, &QPushButton::clicked, this, [this]() {
+    qApp->web()->resourceCache()->clear();
+    updateResourcesCacheStatistics();
+  });
 
   connect(m_ui->m_spinRelativeArticleTime, QOverload<int>::of(&QSpinBox::valueChanged), this, [=](int value) {
     if (value <= 0) {
@@ -73,6 +87,15 @@ SettingsFeedsMessages::SettingsFeedsMessages(Settings* settings, QWidget* parent
     }
   });
 
+  connect(m_ui->m_spinResourcesCacheSize, QOverload<int>::of(&QSpinBox::valueChanged), this, [=](int value) {
+    if (value <= 0) {
+      m_ui->m_spinResourcesCacheSize->setSuffix(QSL(" MB") + tr(" = disabled"));
+    }
+    else {
+      m_ui->m_spinResourcesCacheSize->setSuffix(QSL(" MB"));
+    }
+  });
+
   connect(m_ui->m_spinHeightImageAttachments, QOverload<int>::of(&QSpinBox::valueChanged), this, [=](int value) {
     if (value <= 0) {
       m_ui->m_spinHeightImageAttachments->setSuffix(QSL(" px") + tr(" = unchanged size"));
@@ -208,6 +231,8 @@ SettingsFeedsMessages::SettingsFeedsMessages(Settings* settings, QWidget* parent
   connect(m_ui->m_checkShowTooltips, &QCheckBox::toggled, this, &SettingsFeedsMessages::dirtifySettings);
   connect(m_ui->m_checkMultilineArticleList, &QCheckBox::toggled, this, &SettingsFeedsMessages::dirtifySettings);
   connect(m_ui->m_checkMultilineArticleList, &QCheckBox::toggled, this, &SettingsFeedsMessages::requireRestart);
+  connect(m_ui->m_checkWindowedArticleList, &QCheckBox::toggled, this, &SettingsFeedsMessages::dirtifySettings);
+  connect(m_ui->m_checkWindowedArticleList, &QCheckBox::toggled, this, &SettingsFeedsMessages::requireRestart);
 
   connect(m_ui->m_cmbMessagesDateTimeFormat,
           &QComboBox::currentTextChanged,
@@ -353,11 +378,18 @@ void SettingsFeedsMessages::loadSettings() {
     ->setChecked(settings()->value(GROUP(Messages), SETTING(Messages::IgnoreContentsChanges)).toBool());
   m_ui->m_checkMultilineArticleList
     ->setChecked(settings()->value(GROUP(Messages), SETTING(Messages::MultilineArticleList)).toBool());
+  m_ui->m_checkWindowedArticleList
+    ->setChecked(settings()->value(GROUP(Messages), SETTING(Messages::WindowedArticleList)).toBool());
 
   m_ui->m_cbArticleViewerAlwaysVisible
     ->setChecked(settings()->value(GROUP(Messages), SETTING(Messages::AlwaysDisplayItemPreview)).toBool());
   m_ui->m_spinHeightImageAttachments
     ->setValue(settings()->value(GROUP(Messages), SETTING(Messages::LimitArticleImagesHeight)).toInt());
+  m_ui->m_spinResourcesDownloadsPerHost
+    ->setValue(settings()->value(GROUP(Messages), SETTING(Messages::ResourcesDownloadsPerHost)).toInt());
+  m_ui->m_spinResourcesCacheSize
+    ->setValue(settings()->value(GROUP(Messages), SETTING(Messages::ResourcesCacheSize)).toInt());
+  updateResourcesCacheStatistics();
   m_ui->m_cbShowEnclosuresDirectly
     ->setChecked(settings()->value(GROUP(Messages), SETTING(Messages::DisplayEnclosuresInMessage)).toBool());
 
@@ -487,9 +519,14 @@ void SettingsFeedsMessages::saveSettings() {
   settings()->setValue(GROUP(Feeds), Feeds::EnableTooltipsFeedsMessages, m_ui->m_checkShowTooltips->isChecked());
   settings()->setValue(GROUP(Messages), Messages::IgnoreContentsChanges, m_ui->m_cmbIgnoreContentsChanges->isChecked());
   settings()->setValue(GROUP(Messages), Messages::MultilineArticleList, m_ui->m_checkMultilineArticleList->isChecked());
+  settings()->setValue(GROUP(Messages), Messages::WindowedArticleList, m_ui->m_checkWindowedArticleList->isChecked());
   settings()->setValue(GROUP(Messages),
                        Messages::LimitArticleImagesHeight,
                        m_ui->m_spinHeightImageAttachments->value());
+  settings()->setValue(GROUP(Messages),
+                       Messages::ResourcesDownloadsPerHost,
+                       m_ui->m_spinResourcesDownloadsPerHost->value());
+  settings()->setValue(GROUP(Messages), Messages::ResourcesCacheSize, m_ui->m_spinResourcesCacheSize->value());
   settings()->setValue(GROUP(Messages),
                        Messages::DisplayEnclosuresInMessage,
                        m_ui->m_cbShowEnclosuresDirectly->isChecked());
@@ -549,6 +586,18 @@ void SettingsFeedsMessages::updateDateTimeTooltip() {
   }
 }
 
+void SettingsFeedsMessages::updateResourcesCacheStatistics() {
+  ResourceCache* cache = qApp->web()->resourceCache();
+
+  m_ui->m_lblResourcesCacheStatistics->setText(tr("Pictures cache uses %1 MB, %2 hits and %3 misses, "
+                                                  "decoded pictures have %4 hits and %5 misses.")
+                                                 .arg(QString::number(cache->diskSize() / 1048576.0, 'f', 1),
+                                                      QString::number(cache->diskHits()),
+                                                      QString::number(cache->diskMisses()),
+                                                      QString::number(cache->imageHits()),
+                                                      QString::number(cache->imageMisses())));
+}
+
 void SettingsFeedsMessages::updateArticleMarkingPolicyDelay() {
   m_ui->m_spinArticleMarkingPolicy->setEnabled(selectedArticleMarkingPolicy() ==
                                                MessagesView::ArticleMarkingPolicy::MarkWithDelay);
@@ -23,6 +23,7 @@ class SettingsFeedsMessages : public SettingsPanel {
   private slots:
     void updateDateTimeTooltip();
     void updateArticleMarkingPolicyDelay();
+    void updateResourcesCacheStatistics();
 
   private:
     void changeFont(QLabel& lbl);
@@ -119,6 +119,7 @@ void FeedsToolBar::initializeSearchBox() {
   m_txtSearchMessages =
     new SearchLineEdit({SearchLineEdit::CustomSearchChoice(tr("Everywhere"), int(SearchFields::SearchAll)),
                         SearchLineEdit::CustomSearchChoice(tr("Titles only"), int(SearchFields::SearchTitleOnly))},
+                       false,
                        this);
   m_txtSearchMessages->setSizePolicy(QSizePolicy::Policy::Expanding,
                                      m_txtSearchMessages->sizePolicy().verticalPolicy());
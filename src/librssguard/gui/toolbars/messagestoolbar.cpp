@@ -219,6 +219,7 @@ void MessagesToolBar::initializeSearchBox() {
   m_txtSearchMessages =
     new SearchLineEdit({SearchLineEdit::CustomSearchChoice(tr("Everywhere"), int(SearchFields::SearchAll)),
                         SearchLineEdit::CustomSearchChoice(tr("Titles only"), int(SearchFields::SearchTitleOnly))},
+                       true,
                        this);
   m_txtSearchMessages->setSizePolicy(QSizePolicy::Policy::Expanding,
                                      m_txtSearchMessages->sizePolicy().verticalPolicy());
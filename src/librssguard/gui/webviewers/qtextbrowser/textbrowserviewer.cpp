@@ -15,7 +15,6 @@
 #include "network-web/networkfactory.h"
 #include "network-web/webfactory.h"
 
-#include <QBuffer>
 #include <QContextMenuEvent>
 #include <QFileIconProvider>
 #include <QScrollBar>
@@ -24,8 +23,8 @@
 #include <QtConcurrent>
 
 TextBrowserViewer::TextBrowserViewer(QWidget* parent)
-  : QTextBrowser(parent), m_resourcesEnabled(false), m_resourceDownloader(new Downloader()),
-    m_resourceDownloaderThread(new QThread(this)), m_loadedResources({}),
+  : QTextBrowser(parent), m_resourcesEnabled(false), m_resourceDownloaderThread(new QThread(this)),
+    m_relayoutTimer(new QTimer(this)), m_loadedResources({}),
     m_placeholderImage(qApp->icons()->miscPixmap(QSL("image-placeholder"))),
     m_placeholderImageError(qApp->icons()->miscPixmap(QSL("image-placeholder-error"))),
     m_downloader(new Downloader(this)), m_document(new TextBrowserDocument(this)) {
@@ -41,16 +40,36 @@ TextBrowserViewer::TextBrowserViewer(QWidget* parent)
   setResourcesEnabled(qApp->settings()->value(GROUP(Messages), SETTING(Messages::ShowResourcesInArticles)).toBool());
   setDocument(m_document.data());
 
-  m_resourceDownloader->moveToThread(m_resourceDownloaderThread);
+  for (int i = 0; i < TEXTBROWSER_MAX_PARALLEL_DOWNLOADS; i++) {
+    auto* downloader = new Downloader();
+
+    downloader->moveToThread(m_resourceDownloaderThread);
+    m_resourceDownloaders.append(downloader);
+
+    connect(downloader,
+            &Downloader::completed,
+            this,
+            [this, downloader](const QUrl&,
+                               QNetworkReply::NetworkError status,
+                               int http_code,
+                               const QByteArray& contents) {
+              resourceDownloaded(downloader, status, http_code, contents);
+            });
+  }
+
   m_resourceDownloaderThread->start();
 
+  // Document is re-laid out periodically while its pictures are arriving.
+  m_relayoutTimer->setSingleShot(true);
+  m_relayoutTimer->setInterval(TEXTBROWSER_RELAYOUT_INTERVAL);
+
   connect(this, &TextBrowserViewer::reloadDocument, this, [this]() {
     const auto scr = verticalScrollBarPosition();
     setHtmlPrivate(html(), m_currentUrl);
     setVerticalScrollBarPosition(scr);
   });
 
-  connect(m_resourceDownloader, &Downloader::completed, this, &TextBrowserViewer::resourceDownloaded);
+  connect(m_relayoutTimer, &QTimer::timeout, this, &TextBrowserViewer::reloadDocument);
   connect(this, &QTextBrowser::anchorClicked, this, &TextBrowserViewer::onAnchorClicked);
   connect(this, QOverload<const QUrl&>::of(&QTextBrowser::highlighted), this, &TextBrowserViewer::linkMouseHighlighted);
 }
@@ -60,7 +79,9 @@ TextBrowserViewer::~TextBrowserViewer() {
     m_resourceDownloaderThread->quit();
   }
 
-  m_resourceDownloader->deleteLater();
+  for (Downloader* downloader : std::as_const(m_resourceDownloaders)) {
+    downloader->deleteLater();
+  }
 }
 
 QSize TextBrowserViewer::sizeHint() const {
@@ -84,16 +105,21 @@ QVariant TextBrowserViewer::loadOneResource(int type, const QUrl& name) {
 
   // Resources are enabled and we already have the resource.
   QByteArray resource_data = m_loadedResources.value(resolved_name);
-  QImage img;
 
   if (resource_data.isEmpty()) {
-    img = m_placeholderImageError.toImage();
-  }
-  else {
-    img = QImage::fromData(m_loadedResources.value(resolved_name));
+    return m_placeholderImageError.toImage();
   }
 
   int acceptable_width = int(width() * ACCEPTABLE_IMAGE_PERCENTUAL_WIDTH);
+  const QString image_key = resolved_name.toString() + QL1C('|') + QString::number(acceptable_width);
+  QImage img = qApp->web()->resourceCache()->image(image_key);
+
+  if (!img.isNull()) {
+    return img;
+  }
+
+  img = QImage::fromData(resource_data);
+
   int img_width = img.width();
 
   if (img_width > acceptable_width) {
@@ -105,17 +131,11 @@ QVariant TextBrowserViewer::loadOneResource(int type, const QUrl& name) {
     qWarningNN << LOGSEC_GUI << "Picture" << QUOTE_W_SPACE(name) << "with width" << QUOTE_W_SPACE(img_width)
                << "is too wide, down-scaling to prevent horizontal scrollbars. Scaling took"
                << NONQUOTE_W_SPACE(tmr.elapsed()) << "miliseconds.";
+  }
 
-    QByteArray save_arr;
-    QBuffer save_buf(&save_arr, this);
-
-    if (img.save(&save_buf, "PNG", 100)) {
-      save_buf.close();
-      m_loadedResources.insert(resolved_name, save_arr);
-    }
-    else {
-      qWarningNN << LOGSEC_GUI << "Failed to save modified image" << QUOTE_W_SPACE(name) << "to cache.";
-    }
+  if (!img.isNull()) {
+    // Decoded and scaled picture is kept, so that it does not have to be processed on each relayout.
+    qApp->web()->resourceCache()->storeImage(image_key, img);
   }
 
   return img;
@@ -441,7 +461,23 @@ void TextBrowserViewer::setHtml(const QString& html, const QUrl& base_url) {
                                      })
                                      .toStdList();
 
-    m_neededResources = FROM_STD_LIST(QList<QUrl>, really_needed_resources);
+    m_neededResources.clear();
+
+    for (const QUrl& res : really_needed_resources) {
+      CachedResource cached;
+
+      if (!qApp->web()->resourceCache()->resource(res, cached)) {
+        m_neededResources.append(res);
+      }
+      else if (cached.isFresh()) {
+        m_loadedResources.insert(res, cached.m_data);
+      }
+      else {
+        // Ask server whether our copy is still valid.
+        m_staleResources.insert(res, cached);
+        m_neededResources.append(res);
+      }
+    }
   }
   else {
     m_neededResources = {};
@@ -509,49 +545,125 @@ QVariant TextBrowserDocument::loadResource(int type, const QUrl& name) {
 
 void TextBrowserViewer::reloadHtmlDelayed() {
   if (!m_neededResources.isEmpty()) {
-    downloadNextNeededResource();
+    downloadNeededResources();
   }
 }
 
-void TextBrowserViewer::downloadNextNeededResource() {
-  if (m_neededResources.isEmpty()) {
-    // Everything is downloaded.
-    emit reloadDocument();
-  }
-  else {
-    QUrl res = m_neededResources.takeFirst();
+void TextBrowserViewer::downloadNeededResources() {
+  const int per_host_limit =
+    qMax(1, qApp->settings()->value(GROUP(Messages), SETTING(Messages::ResourcesDownloadsPerHost)).toInt());
+
+  for (int i = 0; i < m_neededResources.size();) {
+    Downloader* downloader = idleResourceDownloader();
 
-    QMetaObject::invokeMethod(m_resourceDownloader,
+    if (downloader == nullptr) {
+      // All downloaders are busy, continue once some of them finishes.
+      break;
+    }
+
+    const QUrl res = m_neededResources.at(i);
+
+    if (m_loadedResources.contains(res) || m_activeResources.key(res, nullptr) != nullptr) {
+      // Resource is already downloaded or its download is in progress.
+      m_neededResources.removeAt(i);
+      continue;
+    }
+
+    if (m_activeResourcesPerHost.value(res.host()) >= per_host_limit) {
+      // Try other hosts first.
+      i++;
+      continue;
+    }
+
+    m_neededResources.removeAt(i);
+
+    if (blockedWithAdblock(res).m_blocked) {
+      m_loadedResources.insert(res, {});
+      continue;
+    }
+
+    m_activeResources.insert(downloader, res);
+    m_activeResourcesPerHost[res.host()]++;
+
+    const CachedResource stale = m_staleResources.value(res);
+
+    QMetaObject::invokeMethod(downloader, "clearRawHeaders", Qt::ConnectionType::QueuedConnection);
+    QMetaObject::invokeMethod(downloader,
+                              "appendRawHeader",
+                              Qt::ConnectionType::QueuedConnection,
+                              Q_ARG(QByteArray, QByteArrayLiteral("If-None-Match")),
+                              Q_ARG(QByteArray, stale.m_eTag));
+    QMetaObject::invokeMethod(downloader,
+                              "appendRawHeader",
+                              Qt::ConnectionType::QueuedConnection,
+                              Q_ARG(QByteArray, QByteArrayLiteral("If-Modified-Since")),
+                              Q_ARG(QByteArray, stale.m_lastModified));
+    QMetaObject::invokeMethod(downloader,
                               "manipulateData",
                               Qt::ConnectionType::QueuedConnection,
                               Q_ARG(QString, WebFactory::unescapeHtml(res.toString())),
                               Q_ARG(QNetworkAccessManager::Operation, QNetworkAccessManager::Operation::GetOperation),
                               Q_ARG(QByteArray, {}),
                               Q_ARG(int, 5000));
+  }
 
-    /*
-m_resourceDownloader.data()->manipulateData(qApp->web()->unescapeHtml(res.toString()),
-                                            QNetworkAccessManager::Operation::GetOperation,
-                                            {},
-                                            5000);
-                                                */
+  if (m_neededResources.isEmpty() && m_activeResources.isEmpty()) {
+    // Everything is downloaded.
+    m_relayoutTimer->stop();
+    emit reloadDocument();
   }
 }
 
-void TextBrowserViewer::resourceDownloaded(const QUrl& url,
+void TextBrowserViewer::resourceDownloaded(Downloader* downloader,
                                            QNetworkReply::NetworkError status,
                                            int http_code,
                                            const QByteArray& contents) {
-  Q_UNUSED(http_code)
+  const QUrl url = m_activeResources.take(downloader);
+  const QString host = url.host();
+  const CachedResource stale = m_staleResources.take(url);
+
+  if (--m_activeResourcesPerHost[host] <= 0) {
+    m_activeResourcesPerHost.remove(host);
+  }
+
+  if (status == QNetworkReply::NetworkError::NoError && http_code == HTTP_CODE_NOT_MODIFIED &&
+      !stale.m_data.isEmpty()) {
+    qApp->web()->resourceCache()->revalidateResource(url, stale);
+    m_loadedResources.insert(url, stale.m_data);
+  }
+  else if (status == QNetworkReply::NetworkError::NoError) {
+    // NOTE: Downloader is idle now, so its response headers can be safely read.
+    const auto headers = downloader->lastHeaders();
+    CachedResource fresh;
+
+    fresh.m_data = contents;
+    fresh.m_eTag = headers.value(QSL("etag")).toUtf8();
+    fresh.m_lastModified = headers.value(QSL("last-modified")).toUtf8();
 
-  if (status == QNetworkReply::NetworkError::NoError) {
+    qApp->web()->resourceCache()->storeResource(url, fresh);
     m_loadedResources.insert(url, contents);
   }
   else {
-    m_loadedResources.insert(url, {});
+    // Outdated copy is still better than nothing.
+    m_loadedResources.insert(url, stale.m_data);
+  }
+
+  downloadNeededResources();
+
+  if (!m_activeResources.isEmpty() && !m_relayoutTimer->isActive()) {
+    // Display already downloaded pictures while waiting for the rest.
+    m_relayoutTimer->start();
+  }
+}
+
+Downloader* TextBrowserViewer::idleResourceDownloader() const {
+  for (Downloader* downloader : m_resourceDownloaders) {
+    if (!m_activeResources.contains(downloader)) {
+      return downloader;
+    }
   }
 
-  downloadNextNeededResource();
+  return nullptr;
 }
 
 PreparedHtml TextBrowserViewer::prepareLegacyHtmlForMessage(const QList<Message>& messages,
@@ -5,6 +5,7 @@
 
 #include "gui/webviewers/webviewer.h"
 #include "network-web/adblock/adblockmanager.h"
+#include "network-web/resourcecache.h"
 
 #include <QNetworkReply>
 #include <QPixmap>
@@ -19,6 +20,9 @@ class Downloader;
 
 class TextBrowserViewer;
 
+#define TEXTBROWSER_MAX_PARALLEL_DOWNLOADS 8
+#define TEXTBROWSER_RELAYOUT_INTERVAL      250
+
 class RSSGUARD_DLLSPEC TextBrowserDocument : public QTextDocument {
     Q_OBJECT
 
@@ -74,11 +78,7 @@ class RSSGUARD_DLLSPEC TextBrowserViewer : public QTextBrowser, public WebViewer
     void downloadLink();
     void onAnchorClicked(const QUrl& url);
     void reloadHtmlDelayed();
-    void downloadNextNeededResource();
-    void resourceDownloaded(const QUrl& url,
-                            QNetworkReply::NetworkError status,
-                            int http_code,
-                            const QByteArray& contents = QByteArray());
+    void downloadNeededResources();
 
   signals:
     void reloadDocument();
@@ -99,14 +99,23 @@ class RSSGUARD_DLLSPEC TextBrowserViewer : public QTextBrowser, public WebViewer
     BlockingResult blockedWithAdblock(const QUrl& url);
 
     QString decodeHtmlData(const QByteArray& data, const QString& content_type) const;
+    void resourceDownloaded(Downloader* downloader,
+                            QNetworkReply::NetworkError status,
+                            int http_code,
+                            const QByteArray& contents);
+    Downloader* idleResourceDownloader() const;
 
   private:
     QScopedPointer<Downloader> m_downloader;
     bool m_resourcesEnabled;
     QList<QUrl> m_neededResources; // All URLs here must be resolved.
-    Downloader* m_resourceDownloader;
+    QList<Downloader*> m_resourceDownloaders;
+    QHash<Downloader*, QUrl> m_activeResources;
+    QHash<QString, int> m_activeResourcesPerHost;
     QThread* m_resourceDownloaderThread;
+    QTimer* m_relayoutTimer;
     QMap<QUrl, QByteArray> m_loadedResources; // All URLs here must be resolved.
+    QHash<QUrl, CachedResource> m_staleResources;
     QPixmap m_placeholderImage;
     QPixmap m_placeholderImageError;
     QUrl m_currentUrl;
@@ -6,6 +6,7 @@
 #include "core/feeddownloader.h"
 #include "core/feedsmodel.h"
 #include "core/feedsproxymodel.h"
+#include "core/messagefilterengine.h"
 #include "core/messagesmodel.h"
 #include "core/messagesproxymodel.h"
 #include "database/databasequeries.h"
@@ -15,9 +16,15 @@
 #include "miscellaneous/pluginfactory.h"
 #include "miscellaneous/settings.h"
 #include "services/abstract/cacheforserviceroot.h"
+#include "services/abstract/importantnode.h"
+#include "services/abstract/labelsnode.h"
+#include "services/abstract/recyclebin.h"
+#include "services/abstract/searchsnode.h"
 #include "services/abstract/serviceentrypoint.h"
 #include "services/abstract/serviceroot.h"
+#include "services/abstract/unreadnode.h"
 
+#include <QSet>
 #include <QThread>
 #include <QTimer>
 
@@ -28,6 +35,13 @@ FeedReader::FeedReader(QObject* parent)
   m_messagesModel = new MessagesModel(this);
   m_messagesProxyModel = new MessagesProxyModel(m_messagesModel, this);
 
+  // Auto-fetching schedule is updated only when feeds change.
+  connect(m_feedsModel, &FeedsModel::rowsInserted, this, &FeedReader::invalidateAutoUpdateSchedule);
+  connect(m_feedsModel, &FeedsModel::rowsRemoved, this, &FeedReader::invalidateAutoUpdateSchedule);
+  connect(m_feedsModel, &FeedsModel::modelReset, this, &FeedReader::invalidateAutoUpdateSchedule);
+
+  m_autoUpdateTimer->setSingleShot(true);
+
   updateAutoUpdateStatus();
   initializeFeedDownloader();
 
@@ -38,6 +52,7 @@ FeedReader::FeedReader(QObject* parent)
                        [this]() {
                          updateFeeds(m_feedsModel->rootItem()->getSubAutoFetchingEnabledFeeds());
                          connect(m_autoUpdateTimer, &QTimer::timeout, this, &FeedReader::executeNextAutoUpdate);
+                         scheduleNextAutoUpdate();
                        });
   }
   else {
@@ -132,10 +147,6 @@ void FeedReader::initializeFeedDownloader() {
   }
 }
 
-QDateTime FeedReader::lastAutoUpdate() const {
-  return m_lastAutoUpdate;
-}
-
 void FeedReader::showMessageFiltersManager() {
   FormMessageFiltersManager manager(qApp->feedReader(),
                                     qApp->feedReader()->feedsModel()->serviceRoots(),
@@ -153,8 +164,8 @@ void FeedReader::updateAutoUpdateStatus() {
   m_globalAutoUpdateInterval = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::AutoUpdateInterval)).toInt();
   m_globalAutoUpdateFast = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::FastAutoUpdate)).toBool();
 
-  if (m_lastAutoUpdate.isNull()) {
-    m_lastAutoUpdate = QDateTime::currentDateTimeUtc();
+  if (m_autoUpdateStart.isNull()) {
+    m_autoUpdateStart = QDateTime::currentDateTimeUtc();
   }
 
   m_globalAutoUpdateEnabled = qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::AutoUpdateEnabled)).toBool();
@@ -162,27 +173,55 @@ void FeedReader::updateAutoUpdateStatus() {
     qApp->settings()->value(GROUP(Feeds), SETTING(Feeds::AutoUpdateOnlyUnfocused)).toBool();
 
   if (m_globalAutoUpdateFast) {
-    // NOTE: In "fast" mode, we set interval to 1 second.
-    // This might have some performance consequences.
-    m_autoUpdateTimer->setInterval(1000);
     qDebugNN << LOGSEC_CORE
              << "Enabling support for very small auto-fetching intervals. This might have performance consequences.";
   }
-  else {
-    m_autoUpdateTimer->setInterval(AUTO_UPDATE_INTERVAL * 1000);
-  }
 
-  // Start global auto-update timer if it is not running yet.
   // NOTE: The timer must run even if global auto-update
   // is not enabled because user can still enable auto-update
   // for individual feeds.
-  if (!m_autoUpdateTimer->isActive()) {
-    m_autoUpdateTimer->start();
-    qDebugNN << LOGSEC_CORE << "Auto-download timer started with interval " << m_autoUpdateTimer->interval() << " ms.";
+  invalidateAutoUpdateSchedule();
+  scheduleNextAutoUpdate();
+}
+
+QDateTime FeedReader::nextAutoUpdate(const Feed* feed) {
+  ensureAutoUpdateSchedule();
+  return m_autoUpdateSchedule.nextDue(feed);
+}
+
+QList<QPair<QDateTime, Feed*>> FeedReader::upcomingAutoUpdates(int count, const ServiceRoot* account) {
+  ensureAutoUpdateSchedule();
+  return m_autoUpdateSchedule.upcoming(count, account);
+}
+
+void FeedReader::invalidateAutoUpdateSchedule() {
+  m_autoUpdateSchedule.invalidate();
+}
+
+void FeedReader::ensureAutoUpdateSchedule() {
+  if (!m_autoUpdateSchedule.isValid()) {
+    m_autoUpdateSchedule.rebuild(m_feedsModel->rootItem()->getSubTreeFeeds(),
+                                 m_autoUpdateStart,
+                                 m_globalAutoUpdateInterval,
+                                 m_globalAutoUpdateEnabled);
   }
-  else {
-    qDebugNN << LOGSEC_CORE << "Auto-download timer is already running.";
+}
+
+void FeedReader::scheduleNextAutoUpdate() {
+  // NOTE: Timer wakes up regularly even if no feed is due because
+  // account caches are synchronized too. In "fast" mode, this
+  // is each second which might have some performance consequences.
+  qint64 wait_msecs = (m_globalAutoUpdateFast ? 1 : AUTO_UPDATE_INTERVAL) * 1000;
+
+  if (m_autoUpdateSchedule.isValid()) {
+    const QDateTime next_due = m_autoUpdateSchedule.nextDue();
+
+    if (next_due.isValid()) {
+      wait_msecs = qBound(qint64(0), QDateTime::currentDateTimeUtc().msecsTo(next_due), wait_msecs);
+    }
   }
+
+  m_autoUpdateTimer->start(int(wait_msecs));
 }
 
 bool FeedReader::autoUpdateEnabled() const {
@@ -228,6 +267,9 @@ void FeedReader::removeMessageFilter(MessageFilter* filter) {
                                                   filter->id());
   DatabaseQueries::removeMessageFilter(qApp->database()->driver()->connection(metaObject()->className()), filter->id());
 
+  // Engines must not keep compiled script of the filter.
+  MessageFilterEngine::resetEngines();
+
   // Free from memory as last step.
   filter->deleteLater();
 }
@@ -311,6 +353,7 @@ void FeedReader::executeNextAutoUpdate() {
              << "user and all account caches are empty.";
 
     // Cannot update, quit.
+    scheduleNextAutoUpdate();
     return;
   }
 
@@ -319,6 +362,7 @@ void FeedReader::executeNextAutoUpdate() {
              << "some time due to another running update.";
 
     // Cannot update, quit.
+    scheduleNextAutoUpdate();
     return;
   }
 
@@ -334,24 +378,17 @@ void FeedReader::executeNextAutoUpdate() {
   if (disable_update_with_window) {
     qDebugNN << LOGSEC_CORE << "Delaying scheduled feed auto-download for some time since window "
              << "is focused. Article cache was synchronised nonetheless.";
+    scheduleNextAutoUpdate();
     return;
   }
 
-  // Pass needed interval data and lets the model decide which feeds
-  // should be updated in this pass.
-  QDateTime current_time = QDateTime::currentDateTimeUtc();
-  bool auto_update_now =
-    m_globalAutoUpdateEnabled && m_lastAutoUpdate.addSecs(m_globalAutoUpdateInterval) < current_time;
+  // Due feeds are taken from the schedule, they are scheduled
+  // again once their update finishes.
+  ensureAutoUpdateSchedule();
 
-  if (auto_update_now) {
-    qDebugNN << LOGSEC_CORE << "Now it's time to auto-fetch articles because last auto-fetch was on"
-             << QUOTE_W_SPACE(m_lastAutoUpdate) << "and next should be in"
-             << NONQUOTE_W_SPACE(m_globalAutoUpdateInterval) << "seconds.";
+  QList<Feed*> feeds_for_update = m_autoUpdateSchedule.takeDueFeeds(QDateTime::currentDateTimeUtc());
 
-    m_lastAutoUpdate = current_time;
-  }
-
-  QList<Feed*> feeds_for_update = m_feedsModel->feedsForScheduledUpdate(auto_update_now);
+  scheduleNextAutoUpdate();
 
   if (!feeds_for_update.isEmpty()) {
     // Request update for given feeds.
@@ -370,7 +407,36 @@ void FeedReader::executeNextAutoUpdate() {
 }
 
 void FeedReader::onFeedUpdatesFinished(FeedDownloadResults updated_feeds) {
-  m_feedsModel->reloadWholeLayout();
+  // Updated feeds have new last update time.
+  invalidateAutoUpdateSchedule();
+
+  // Counts were already adjusted during the update, now we only let views know about
+  // fetched feeds, their parents and special items of their accounts.
+  QList<RootItem*> changed_items;
+  QSet<ServiceRoot*> accounts;
+  auto fetched_feeds = updated_feeds.fetchedFeeds();
+
+  for (Feed* feed : std::as_const(fetched_feeds)) {
+    changed_items.append(feed);
+    accounts.insert(feed->getParentServiceRoot());
+  }
+
+  for (ServiceRoot* acc : std::as_const(accounts)) {
+    const QList<RootItem*> special_items = {acc->recycleBin(),
+                                            acc->importantNode(),
+                                            acc->unreadNode(),
+                                            acc->labelsNode(),
+                                            acc->probesNode()};
+
+    for (RootItem* special_item : special_items) {
+      if (special_item != nullptr) {
+        changed_items.append(special_item);
+        changed_items.append(special_item->childItems());
+      }
+    }
+  }
+
+  m_feedsModel->reloadChangedItems(changed_items);
   m_feedsModel->notifyWithCounts();
 
   emit feedUpdatesFinished(updated_feeds);
@@ -4,6 +4,7 @@
 #define FEEDREADER_H
 
 #include "core/feeddownloader.h"
+#include "core/feedupdatescheduler.h"
 #include "core/messagefilter.h"
 #include "services/abstract/cacheforserviceroot.h"
 #include "services/abstract/feed.h"
@@ -15,6 +16,7 @@ class MessagesModel;
 class MessagesProxyModel;
 class FeedsProxyModel;
 class ServiceEntryPoint;
+class ServiceRoot;
 class QTimer;
 class QThread;
 
@@ -52,7 +54,15 @@ class RSSGUARD_DLLSPEC FeedReader : public QObject {
 
     bool autoUpdateEnabled() const;
     int autoUpdateInterval() const;
-    QDateTime lastAutoUpdate() const;
+
+    // Returns time of next scheduled auto-fetch of the feed or
+    // invalid date if the feed is not auto-fetched.
+    QDateTime nextAutoUpdate(const Feed* feed);
+    QList<QPair<QDateTime, Feed*>> upcomingAutoUpdates(int count, const ServiceRoot* account = nullptr);
+
+    // Schedule is rebuilt on next auto-update check, call this
+    // when auto-fetching setup of any feed changes.
+    void invalidateAutoUpdateSchedule();
 
     void loadSavedMessageFilters();
     QList<MessageFilter*> messageFilters() const;
@@ -79,6 +89,8 @@ class RSSGUARD_DLLSPEC FeedReader : public QObject {
 
   private:
     void initializeFeedDownloader();
+    void ensureAutoUpdateSchedule();
+    void scheduleNextAutoUpdate();
 
   private:
     QList<ServiceEntryPoint*> m_feedServices;
@@ -94,7 +106,8 @@ class RSSGUARD_DLLSPEC FeedReader : public QObject {
     bool m_globalAutoUpdateFast{};
     bool m_globalAutoUpdateOnlyUnfocused{};
     int m_globalAutoUpdateInterval{}; // In seconds.
-    QDateTime m_lastAutoUpdate;
+    QDateTime m_autoUpdateStart;
+    FeedUpdateScheduler m_autoUpdateSchedule;
     QThread* m_feedDownloaderThread;
     FeedDownloader* m_feedDownloader;
 };
@@ -6,8 +6,169 @@
 #include "miscellaneous/settings.h"
 
 #include <QBuffer>
+#include <QCryptographicHash>
+#include <QIconEngine>
+#include <QMutex>
 #include <QPainter>
 
+#include <memory>
+
+static QIcon decodeIcon(QByteArray array) {
+  array = QByteArray::fromBase64(array);
+  QIcon icon;
+  QBuffer buffer(&array);
+
+  buffer.open(QIODevice::OpenModeFlag::ReadOnly);
+  QDataStream in(&buffer);
+
+  in.setVersion(QDataStream::Version::Qt_4_7);
+  in >> icon;
+  buffer.close();
+  return icon;
+}
+
+// Base64-encoded icon data shared by all icons which were created from
+// identical data. Data is decoded on first paint.
+struct LazyIconData {
+    ~LazyIconData();
+
+    // Guards decoding and use of decoded icon, icons might be
+    // queried from worker threads.
+    QMutex m_mutex;
+    QByteArray m_hash;
+    QByteArray m_data;
+    QIcon m_icon;
+    bool m_decoded = false;
+};
+
+// Icons are addressed by hash of their data so that feeds with identical
+// icons share single decoded icon. Store holds weak references only, data
+// is removed from the store once the last icon which uses it is destroyed.
+struct IconStore {
+    QMutex m_mutex;
+    QHash<QByteArray, std::weak_ptr<LazyIconData>> m_icons;
+    QHash<qint64, std::weak_ptr<LazyIconData>> m_data;
+};
+
+static IconStore& iconStore() {
+  // NOTE: Store is never destroyed, because icons might
+  // still be destroyed when static objects are destroyed.
+  static auto* store = new IconStore();
+
+  return *store;
+}
+
+LazyIconData::~LazyIconData() {
+  IconStore& store = iconStore();
+  QMutexLocker lck(&store.m_mutex);
+  auto stored_data = store.m_icons.find(m_hash);
+
+  // Identical data might have been stored again in the meantime.
+  if (stored_data != store.m_icons.end() && stored_data->expired()) {
+    store.m_icons.erase(stored_data);
+  }
+}
+
+class LazyIconEngine : public QIconEngine {
+  public:
+    explicit LazyIconEngine(const std::shared_ptr<LazyIconData>& data) : m_data(data), m_cacheKey(0) {}
+
+    // Copy of engine belongs to another (modified) icon.
+    LazyIconEngine(const LazyIconEngine& other) : QIconEngine(other), m_data(other.m_data), m_cacheKey(0) {}
+
+    virtual ~LazyIconEngine() {
+      if (m_cacheKey != 0) {
+        IconStore& store = iconStore();
+        QMutexLocker lck(&store.m_mutex);
+
+        store.m_data.remove(m_cacheKey);
+      }
+    }
+
+    // Makes icon with given cache key recognizable by IconFactory::toByteArray().
+    void setCacheKey(qint64 cache_key) {
+      m_cacheKey = cache_key;
+    }
+
+    virtual void paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state) {
+      QMutexLocker lck(&m_data->m_mutex);
+
+      icon().paint(painter, rect, Qt::AlignmentFlag::AlignCenter, mode, state);
+    }
+
+    virtual QPixmap pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state) {
+      QMutexLocker lck(&m_data->m_mutex);
+
+      return icon().pixmap(size, mode, state);
+    }
+
+    virtual QSize actualSize(const QSize& size, QIcon::Mode mode, QIcon::State state) {
+      QMutexLocker lck(&m_data->m_mutex);
+
+      return icon().actualSize(size, mode, state);
+    }
+
+    virtual QIconEngine* clone() const {
+      return new LazyIconEngine(*this);
+    }
+
+    virtual QString key() const {
+      return QSL("LazyIconEngine");
+    }
+
+#if QT_VERSION >= 0x060000 // Qt >= 6.0.0
+    virtual QList<QSize> availableSizes(QIcon::Mode mode, QIcon::State state) {
+      QMutexLocker lck(&m_data->m_mutex);
+
+      return icon().availableSizes(mode, state);
+    }
+
+    virtual bool isNull() {
+      QMutexLocker lck(&m_data->m_mutex);
+
+      return icon().isNull();
+    }
+#else
+    virtual void virtual_hook(int id, void* data) {
+      switch (id) {
+        case QIconEngine::IconEngineHook::AvailableSizesHook: {
+          auto* arg = reinterpret_cast<QIconEngine::AvailableSizesArgument*>(data);
+          QMutexLocker lck(&m_data->m_mutex);
+
+          arg->sizes = icon().availableSizes(arg->mode, arg->state);
+          break;
+        }
+
+        case QIconEngine::IconEngineHook::IsNullHook: {
+          QMutexLocker lck(&m_data->m_mutex);
+
+          *reinterpret_cast<bool*>(data) = icon().isNull();
+          break;
+        }
+
+        default:
+          QIconEngine::virtual_hook(id, data);
+          break;
+      }
+    }
+#endif
+
+  private:
+    // NOTE: Mutex of data must be locked.
+    const QIcon& icon() {
+      if (!m_data->m_decoded) {
+        m_data->m_icon = decodeIcon(m_data->m_data);
+        m_data->m_decoded = true;
+      }
+
+      return m_data->m_icon;
+    }
+
+  private:
+    std::shared_ptr<LazyIconData> m_data;
+    qint64 m_cacheKey;
+};
+
 IconFactory::IconFactory(QObject* parent) : QObject(parent) {}
 
 IconFactory::~IconFactory() {
@@ -28,21 +189,35 @@ QIcon IconFactory::generateIcon(const QColor& color) {
   return pxm;
 }
 
-QIcon IconFactory::fromByteArray(QByteArray array) {
+QIcon IconFactory::fromByteArray(const QByteArray& array) {
   if (array.isEmpty()) {
     return {};
   }
 
-  array = QByteArray::fromBase64(array);
-  QIcon icon;
-  QBuffer buffer(&array);
+  const QByteArray hash = QCryptographicHash::hash(array, QCryptographicHash::Algorithm::Sha1);
+  IconStore& store = iconStore();
 
-  buffer.open(QIODevice::OpenModeFlag::ReadOnly);
-  QDataStream in(&buffer);
+  // NOTE: Data is declared before the lock, so that it is released
+  // only after store gets unlocked.
+  std::shared_ptr<LazyIconData> data;
+  QMutexLocker lck(&store.m_mutex);
+
+  data = store.m_icons.value(hash).lock();
+
+  if (!data) {
+    data = std::make_shared<LazyIconData>();
+    data->m_hash = hash;
+    data->m_data = array;
+
+    store.m_icons.insert(hash, data);
+  }
+
+  auto* engine = new LazyIconEngine(data);
+  QIcon icon(engine);
+
+  engine->setCacheKey(icon.cacheKey());
+  store.m_data.insert(icon.cacheKey(), data);
 
-  in.setVersion(QDataStream::Version::Qt_4_7);
-  in >> icon;
-  buffer.close();
   return icon;
 }
 
@@ -51,6 +226,19 @@ QByteArray IconFactory::toByteArray(const QIcon& icon) {
     return {};
   }
 
+  {
+    // Icons loaded from stored data are saved back as they are.
+    IconStore& store = iconStore();
+    std::shared_ptr<LazyIconData> data;
+    QMutexLocker lck(&store.m_mutex);
+
+    data = store.m_data.value(icon.cacheKey()).lock();
+
+    if (data) {
+      return data->m_data;
+    }
+  }
+
   QByteArray array;
   QBuffer buffer(&array);
 
@@ -23,8 +23,9 @@ class RSSGUARD_DLLSPEC IconFactory : public QObject {
     static QIcon generateIcon(const QColor& color);
 
     // Used to store/retrieve QIcons from/to Base64-encoded
-    // byte array.
-    static QIcon fromByteArray(QByteArray array);
+    // byte array. Icons with identical data are shared and
+    // decoded only when they are painted for the first time.
+    static QIcon fromByteArray(const QByteArray& array);
     static QByteArray toByteArray(const QIcon& icon);
 
     // Returns icon from active theme or invalid icon if
@@ -181,6 +181,12 @@ DVALUE(bool) Messages::EnableMessagePreviewDef = true;
 DKEY Messages::ShowResourcesInArticles = "enable_message_resources";
 DVALUE(bool) Messages::ShowResourcesInArticlesDef = true;
 
+DKEY Messages::ResourcesDownloadsPerHost = "message_resources_downloads_per_host";
+DVALUE(int) Messages::ResourcesDownloadsPerHostDef = 4;
+
+DKEY Messages::ResourcesCacheSize = "message_resources_cache_size";
+DVALUE(int) Messages::ResourcesCacheSizeDef = 100;
+
 DKEY Messages::Zoom = "zoom";
 DVALUE(qreal) Messages::ZoomDef = double(1.0);
 
@@ -214,6 +220,9 @@ DVALUE(int) Messages::ArticleListPaddingDef = -1;
 DKEY Messages::MultilineArticleList = "multiline_article_list";
 DVALUE(bool) Messages::MultilineArticleListDef = false;
 
+DKEY Messages::WindowedArticleList = "windowed_article_list";
+DVALUE(bool) Messages::WindowedArticleListDef = false;
+
 DKEY Messages::UseCustomTime = "use_custom_time";
 DVALUE(bool) Messages::UseCustomTimeDef = false;
 
@@ -458,6 +467,12 @@ DKEY Database::ID = "database";
 DKEY Database::UseInMemory = "use_in_memory_db";
 DVALUE(bool) Database::UseInMemoryDef = false;
 
+DKEY Database::SqliteStorageProfile = "sqlite_storage_profile";
+DVALUE(int) Database::SqliteStorageProfileDef = 0; /* SqliteDriver::StorageProfile::Fast */
+
+DKEY Database::SqliteCacheSize = "sqlite_cache_size";
+DVALUE(int) Database::SqliteCacheSizeDef = 256;
+
 DKEY Database::MySQLHostname = "mysql_hostname";
 DVALUE(QString) Database::MySQLHostnameDef = QString();
 
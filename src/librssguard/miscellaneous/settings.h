@@ -188,6 +188,12 @@ namespace Messages {
   KEY ShowResourcesInArticles;
   VALUE(bool) ShowResourcesInArticlesDef;
 
+  KEY ResourcesDownloadsPerHost;
+  VALUE(int) ResourcesDownloadsPerHostDef;
+
+  KEY ResourcesCacheSize;
+  VALUE(int) ResourcesCacheSizeDef;
+
   KEY Zoom;
   VALUE(qreal) ZoomDef;
 
@@ -218,6 +224,9 @@ namespace Messages {
   KEY MultilineArticleList;
   VALUE(bool) MultilineArticleListDef;
 
+  KEY WindowedArticleList;
+  VALUE(bool) WindowedArticleListDef;
+
   KEY CustomTimeFormat;
   VALUE(QString) CustomTimeFormatDef;
 
@@ -491,6 +500,14 @@ namespace Database {
 
   VALUE(bool) UseInMemoryDef;
 
+  KEY SqliteStorageProfile;
+
+  VALUE(int) SqliteStorageProfileDef;
+
+  KEY SqliteCacheSize;
+
+  VALUE(int) SqliteCacheSizeDef;
+
   KEY MySQLHostname;
 
   VALUE(QString) MySQLHostnameDef;
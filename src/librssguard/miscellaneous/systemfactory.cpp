@@ -9,6 +9,7 @@
 #include "miscellaneous/application.h"
 #include "miscellaneous/settings.h"
 #include "miscellaneous/systemfactory.h"
+#include "network-web/networkfactory.h"
 
 #if defined(Q_OS_WIN)
 #include <QSettings>
@@ -234,21 +235,26 @@ QString SystemFactory::loggedInUser() const {
 }
 
 void SystemFactory::checkForUpdates() const {
-  auto* downloader = new Downloader();
-
-  connect(downloader, &Downloader::completed, this, [this, downloader]() {
-    QPair<QList<UpdateInfo>, QNetworkReply::NetworkError> result;
-    result.second = downloader->lastOutputError();
-
-    if (result.second == QNetworkReply::NoError) {
-      QByteArray obtained_data = downloader->lastOutputData();
-      result.first = parseUpdatesFile(obtained_data);
-    }
-
-    emit updatesChecked(result);
-    downloader->deleteLater();
-  });
-  downloader->downloadFile(QSL(RELEASES_LIST));
+  NetworkFactory::performAsyncNetworkOperation(QSL(RELEASES_LIST),
+                                               DOWNLOAD_TIMEOUT,
+                                               {},
+                                               QNetworkAccessManager::Operation::GetOperation,
+                                               {},
+                                               false,
+                                               {},
+                                               {},
+                                               QNetworkProxy::ProxyType::DefaultProxy,
+                                               this,
+                                               [this](const NetworkResult& res, const QByteArray& output) {
+                                                 QPair<QList<UpdateInfo>, QNetworkReply::NetworkError> result;
+                                                 result.second = res.m_networkError;
+
+                                                 if (result.second == QNetworkReply::NoError) {
+                                                   result.first = parseUpdatesFile(output);
+                                                 }
+
+                                                 emit updatesChecked(result);
+                                               });
 }
 
 void SystemFactory::checkForUpdatesOnStartup() {
@@ -14,20 +14,24 @@
 #include <QTimer>
 
 Downloader::Downloader(QObject* parent)
-  : QObject(parent), m_activeReply(nullptr), m_downloadManager(new SilentNetworkAccessManager(this)),
-    m_timer(new QTimer(this)), m_inputData(QByteArray()), m_inputMultipartData(nullptr), m_targetProtected(false),
-    m_targetUsername(QString()), m_targetPassword(QString()), m_lastOutputData({}),
-    m_lastOutputError(QNetworkReply::NetworkError::NoError), m_lastHttpStatusCode(0), m_lastHeaders({}) {
+  : QObject(parent), m_activeReply(nullptr), m_timer(new QTimer(this)), m_inputData(QByteArray()),
+    m_inputMultipartData(nullptr), m_targetProtected(false), m_targetUsername(QString()), m_targetPassword(QString()),
+    m_lastOutputData({}), m_lastOutputError(QNetworkReply::NetworkError::NoError), m_lastHttpStatusCode(0),
+    m_lastHeaders({}) {
   m_timer->setInterval(DOWNLOAD_TIMEOUT);
   m_timer->setSingleShot(true);
 
   connect(m_timer, &QTimer::timeout, this, &Downloader::cancel);
-
-  m_downloadManager->setCookieJar(qApp->web()->cookieJar());
-  qApp->web()->cookieJar()->setParent(nullptr);
 }
 
 Downloader::~Downloader() {
+  if (m_activeReply != nullptr) {
+    // Reply is owned by shared network manager, so we must get rid of it.
+    m_activeReply->disconnect(this);
+    m_activeReply->abort();
+    m_activeReply->deleteLater();
+  }
+
   qDebugNN << LOGSEC_NETWORK << "Destroying Downloader instance.";
 }
 
@@ -214,6 +218,10 @@ void Downloader::finished() {
   }
   else {
     // No redirection is indicated. Final file is obtained in our "reply" object.
+    // NOTE: Qt negotiates compression with "Accept-Encoding" on its own and
+    // decodes the body while it arrives, so the data are already decompressed.
+    NetworkFactory::countTransfer(reply);
+
     // Read the data into output buffer.
     if (m_inputMultipartData == nullptr) {
       m_lastOutputData = reply->readAll();
@@ -332,7 +340,7 @@ QList<HttpResponse> Downloader::decodeMultipartAnswer(QNetworkReply* reply) {
 
 void Downloader::runDeleteRequest(const QNetworkRequest& request) {
   m_timer->start();
-  m_activeReply = m_downloadManager->deleteResource(request);
+  m_activeReply = networkManager()->deleteResource(request);
   setCustomPropsToReply(m_activeReply);
   connect(m_activeReply, &QNetworkReply::downloadProgress, this, &Downloader::progressInternal);
   connect(m_activeReply, &QNetworkReply::finished, this, &Downloader::finished);
@@ -340,7 +348,7 @@ void Downloader::runDeleteRequest(const QNetworkRequest& request) {
 
 void Downloader::runPutRequest(const QNetworkRequest& request, const QByteArray& data) {
   m_timer->start();
-  m_activeReply = m_downloadManager->put(request, data);
+  m_activeReply = networkManager()->put(request, data);
   setCustomPropsToReply(m_activeReply);
   connect(m_activeReply, &QNetworkReply::downloadProgress, this, &Downloader::progressInternal);
   connect(m_activeReply, &QNetworkReply::finished, this, &Downloader::finished);
@@ -348,7 +356,7 @@ void Downloader::runPutRequest(const QNetworkRequest& request, const QByteArray&
 
 void Downloader::runPostRequest(const QNetworkRequest& request, QHttpMultiPart* multipart_data) {
   m_timer->start();
-  m_activeReply = m_downloadManager->post(request, multipart_data);
+  m_activeReply = networkManager()->post(request, multipart_data);
   setCustomPropsToReply(m_activeReply);
   connect(m_activeReply, &QNetworkReply::downloadProgress, this, &Downloader::progressInternal);
   connect(m_activeReply, &QNetworkReply::finished, this, &Downloader::finished);
@@ -356,7 +364,7 @@ void Downloader::runPostRequest(const QNetworkRequest& request, QHttpMultiPart*
 
 void Downloader::runPostRequest(const QNetworkRequest& request, const QByteArray& data) {
   m_timer->start();
-  m_activeReply = m_downloadManager->post(request, data);
+  m_activeReply = networkManager()->post(request, data);
   setCustomPropsToReply(m_activeReply);
   connect(m_activeReply, &QNetworkReply::downloadProgress, this, &Downloader::progressInternal);
   connect(m_activeReply, &QNetworkReply::finished, this, &Downloader::finished);
@@ -364,7 +372,7 @@ void Downloader::runPostRequest(const QNetworkRequest& request, const QByteArray
 
 void Downloader::runGetRequest(const QNetworkRequest& request) {
   m_timer->start();
-  m_activeReply = m_downloadManager->get(request);
+  m_activeReply = networkManager()->get(request);
   setCustomPropsToReply(m_activeReply);
   connect(m_activeReply, &QNetworkReply::downloadProgress, this, &Downloader::progressInternal);
   connect(m_activeReply, &QNetworkReply::finished, this, &Downloader::finished);
@@ -390,7 +398,18 @@ void Downloader::setProxy(const QNetworkProxy& proxy) {
   qWarningNN << LOGSEC_NETWORK << "Setting specific downloader proxy, address:" << QUOTE_W_SPACE_COMMA(proxy.hostName())
              << " type:" << QUOTE_W_SPACE_DOT(proxy.type());
 
-  m_downloadManager->setProxy(proxy);
+  if (m_customDownloadManager.isNull()) {
+    // Shared network manager cannot be used with specific proxy.
+    m_customDownloadManager.reset(new SilentNetworkAccessManager(this));
+    m_customDownloadManager->setCookieJar(qApp->web()->cookieJar());
+    qApp->web()->cookieJar()->setParent(nullptr);
+  }
+
+  m_customDownloadManager->setProxy(proxy);
+}
+
+SilentNetworkAccessManager* Downloader::networkManager() const {
+  return m_customDownloadManager.isNull() ? NetworkFactory::threadNetworkManager() : m_customDownloadManager.data();
 }
 
 void Downloader::cancel() {
@@ -406,6 +425,10 @@ void Downloader::appendRawHeader(const QByteArray& name, const QByteArray& value
   }
 }
 
+void Downloader::clearRawHeaders() {
+  m_customHeaders.clear();
+}
+
 QNetworkReply::NetworkError Downloader::lastOutputError() const {
   return m_lastOutputError;
 }
@@ -37,6 +37,7 @@ class Downloader : public QObject {
     void cancel();
 
     void appendRawHeader(const QByteArray& name, const QByteArray& value);
+    void clearRawHeaders();
 
     // Performs asynchronous download of given file. Redirections are handled.
     void downloadFile(const QString& url,
@@ -81,6 +82,7 @@ class Downloader : public QObject {
     void progressInternal(qint64 bytes_received, qint64 bytes_total);
 
   private:
+    SilentNetworkAccessManager* networkManager() const;
     void setCustomPropsToReply(QNetworkReply* reply);
     QList<HttpResponse> decodeMultipartAnswer(QNetworkReply* reply);
     void manipulateData(const QString& url,
@@ -99,7 +101,10 @@ class Downloader : public QObject {
 
   private:
     QNetworkReply* m_activeReply;
-    QScopedPointer<SilentNetworkAccessManager> m_downloadManager;
+
+    // Only used when downloader has its own proxy, shared
+    // network manager of current thread is used otherwise.
+    QScopedPointer<SilentNetworkAccessManager> m_customDownloadManager;
     QTimer* m_timer;
     QHash<QByteArray, QByteArray> m_customHeaders;
     QByteArray m_inputData;
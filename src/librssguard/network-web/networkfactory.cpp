@@ -3,16 +3,34 @@
 #include "network-web/networkfactory.h"
 
 #include "definitions/definitions.h"
+#include "miscellaneous/application.h"
+#include "network-web/cookiejar.h"
 #include "network-web/downloader.h"
+#include "network-web/silentnetworkaccessmanager.h"
+#include "network-web/webfactory.h"
 
+#include <QDateTime>
 #include <QEventLoop>
 #include <QIcon>
 #include <QMetaEnum>
 #include <QPixmap>
 #include <QRegularExpression>
 #include <QTextDocument>
+#include <QThreadStorage>
 #include <QTimer>
 
+#include <algorithm>
+#include <atomic>
+
+// Version of network settings, shared network managers reload their
+// settings when they see newer version.
+static std::atomic_int s_networkSettingsVersion(0);
+
+struct ThreadNetworkManager {
+    QScopedPointer<SilentNetworkAccessManager> m_manager;
+    int m_settingsVersion = 0;
+};
+
 QStringList NetworkFactory::extractFeedLinksFromHtmlPage(const QUrl& url, const QString& html) {
   QStringList feeds;
   QRegularExpression rx(QSL(FEED_REGEX_MATCHER), QRegularExpression::PatternOption::CaseInsensitiveOption);
@@ -274,33 +292,16 @@ NetworkResult NetworkFactory::performNetworkOperation(const QString& url,
                                                       const QNetworkProxy& custom_proxy) {
   Downloader downloader;
   QEventLoop loop;
-  NetworkResult result;
 
   // We need to quit event loop when the download finishes.
   QObject::connect(&downloader, &Downloader::completed, &loop, &QEventLoop::quit);
 
-  for (const auto& header : additional_headers) {
-    if (!header.first.isEmpty()) {
-      downloader.appendRawHeader(header.first, header.second);
-    }
-  }
-
-  if (custom_proxy.type() != QNetworkProxy::ProxyType::DefaultProxy) {
-    downloader.setProxy(custom_proxy);
-  }
-
+  setupDownloader(downloader, additional_headers, custom_proxy);
   downloader.manipulateData(url, operation, input_data, timeout, protected_contents, username, password);
   loop.exec();
 
   output = downloader.lastOutputData();
-
-  result.m_networkError = downloader.lastOutputError();
-  result.m_contentType = downloader.lastContentType();
-  result.m_cookies = downloader.lastCookies();
-  result.m_httpCode = downloader.lastHttpStatusCode();
-  result.m_headers = downloader.lastHeaders();
-
-  return result;
+  return downloaderResult(downloader);
 }
 
 NetworkResult NetworkFactory::performNetworkOperation(const QString& url,
@@ -315,11 +316,113 @@ NetworkResult NetworkFactory::performNetworkOperation(const QString& url,
                                                       const QNetworkProxy& custom_proxy) {
   Downloader downloader;
   QEventLoop loop;
-  NetworkResult result;
 
   // We need to quit event loop when the download finishes.
   QObject::connect(&downloader, &Downloader::completed, &loop, &QEventLoop::quit);
 
+  setupDownloader(downloader, additional_headers, custom_proxy);
+  downloader.manipulateData(url, operation, input_data, timeout, protected_contents, username, password);
+  loop.exec();
+
+  output = downloader.lastOutputMultipartData();
+  return downloaderResult(downloader);
+}
+
+void NetworkFactory::performAsyncNetworkOperation(const QString& url,
+                                                  int timeout,
+                                                  const QByteArray& input_data,
+                                                  QNetworkAccessManager::Operation operation,
+                                                  const QList<QPair<QByteArray, QByteArray>>& additional_headers,
+                                                  bool protected_contents,
+                                                  const QString& username,
+                                                  const QString& password,
+                                                  const QNetworkProxy& custom_proxy,
+                                                  const QObject* context,
+                                                  const NetworkCallback& callback) {
+  auto* downloader = new Downloader();
+
+  QObject::connect(downloader, &Downloader::completed, downloader, &Downloader::deleteLater);
+  QObject::connect(downloader, &Downloader::completed, context, [downloader, callback]() {
+    callback(downloaderResult(*downloader), downloader->lastOutputData());
+  });
+
+  setupDownloader(*downloader, additional_headers, custom_proxy);
+  downloader->manipulateData(url, operation, input_data, timeout, protected_contents, username, password);
+}
+
+SilentNetworkAccessManager* NetworkFactory::threadNetworkManager() {
+  // NOTE: Managers are destroyed together with their threads.
+  static QThreadStorage<ThreadNetworkManager*> managers;
+
+  if (!managers.hasLocalData()) {
+    auto* thread_manager = new ThreadNetworkManager();
+
+    thread_manager->m_settingsVersion = s_networkSettingsVersion;
+    thread_manager->m_manager.reset(new SilentNetworkAccessManager());
+    thread_manager->m_manager->setCookieJar(qApp->web()->cookieJar());
+    qApp->web()->cookieJar()->setParent(nullptr);
+
+    managers.setLocalData(thread_manager);
+  }
+
+  ThreadNetworkManager* thread_manager = managers.localData();
+
+  if (thread_manager->m_settingsVersion != s_networkSettingsVersion) {
+    thread_manager->m_settingsVersion = s_networkSettingsVersion;
+    thread_manager->m_manager->loadSettings();
+  }
+
+  return thread_manager->m_manager.data();
+}
+
+void NetworkFactory::reloadThreadNetworkManagers() {
+  s_networkSettingsVersion++;
+}
+
+static NetworkTransferStats& localTransferStats() {
+  static QThreadStorage<NetworkTransferStats> stats;
+
+  return stats.localData();
+}
+
+NetworkTransferStats NetworkFactory::threadTransferStats() {
+  return localTransferStats();
+}
+
+void NetworkFactory::countTransfer(QNetworkReply* reply) {
+  NetworkTransferStats& stats = localTransferStats();
+
+  stats.m_responses++;
+  stats.m_decodedBytes += reply->bytesAvailable();
+
+  if (reply->hasRawHeader(QByteArrayLiteral("Content-Encoding"))) {
+    stats.m_compressedResponses++;
+  }
+
+  const int http_code = reply->attribute(QNetworkRequest::Attribute::HttpStatusCodeAttribute).toInt();
+
+  if (http_code == HTTP_CODE_TOO_MANY_REQUESTS ||
+      (http_code == HTTP_CODE_UNAVAILABLE && reply->hasRawHeader(HTTP_HEADERS_RETRY_AFTER))) {
+    // "Retry-After" holds either number of seconds or HTTP date.
+    const QString retry_after = QString::fromLatin1(reply->rawHeader(HTTP_HEADERS_RETRY_AFTER)).trimmed();
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    bool is_number = false;
+    qint64 throttled_until = retry_after.toLongLong(&is_number) * 1000 + now;
+
+    if (!is_number) {
+      QDateTime retry_date = QDateTime::fromString(retry_after, Qt::DateFormat::RFC2822Date);
+
+      throttled_until = retry_date.isValid() ? retry_date.toMSecsSinceEpoch() : now;
+    }
+
+    stats.m_throttledResponses++;
+    stats.m_throttledUntil = std::max(stats.m_throttledUntil, throttled_until);
+  }
+}
+
+void NetworkFactory::setupDownloader(Downloader& downloader,
+                                     const QList<QPair<QByteArray, QByteArray>>& additional_headers,
+                                     const QNetworkProxy& custom_proxy) {
   for (const auto& header : additional_headers) {
     if (!header.first.isEmpty()) {
       downloader.appendRawHeader(header.first, header.second);
@@ -329,11 +432,10 @@ NetworkResult NetworkFactory::performNetworkOperation(const QString& url,
   if (custom_proxy.type() != QNetworkProxy::ProxyType::DefaultProxy) {
     downloader.setProxy(custom_proxy);
   }
+}
 
-  downloader.manipulateData(url, operation, input_data, timeout, protected_contents, username, password);
-  loop.exec();
-
-  output = downloader.lastOutputMultipartData();
+NetworkResult NetworkFactory::downloaderResult(const Downloader& downloader) {
+  NetworkResult result;
 
   result.m_networkError = downloader.lastOutputError();
   result.m_contentType = downloader.lastContentType();
@@ -353,3 +455,25 @@ NetworkResult::NetworkResult(QNetworkReply::NetworkError err,
                              const QString& ct,
                              const QList<QNetworkCookie>& cook)
   : m_networkError(err), m_httpCode(http_code), m_contentType(ct), m_cookies(cook) {}
+
+NetworkTransferStats NetworkTransferStats::operator-(const NetworkTransferStats& other) const {
+  NetworkTransferStats diff;
+
+  diff.m_responses = m_responses - other.m_responses;
+  diff.m_compressedResponses = m_compressedResponses - other.m_compressedResponses;
+  diff.m_decodedBytes = m_decodedBytes - other.m_decodedBytes;
+  diff.m_throttledResponses = m_throttledResponses - other.m_throttledResponses;
+  diff.m_throttledUntil = m_throttledUntil;
+
+  return diff;
+}
+
+NetworkTransferStats& NetworkTransferStats::operator+=(const NetworkTransferStats& other) {
+  m_responses += other.m_responses;
+  m_compressedResponses += other.m_compressedResponses;
+  m_decodedBytes += other.m_decodedBytes;
+  m_throttledResponses += other.m_throttledResponses;
+  m_throttledUntil = std::max(m_throttledUntil, other.m_throttledUntil);
+
+  return *this;
+}
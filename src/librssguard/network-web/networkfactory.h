@@ -15,6 +15,8 @@
 #include <QPair>
 #include <QVariant>
 
+#include <functional>
+
 struct RSSGUARD_DLLSPEC NetworkResult {
     QNetworkReply::NetworkError m_networkError;
     int m_httpCode;
@@ -29,7 +31,28 @@ struct RSSGUARD_DLLSPEC NetworkResult {
                            const QList<QNetworkCookie>& cook);
 };
 
+// Statistics of HTTP responses received by single thread.
+// NOTE: Responses are transparently decompressed by Qt, which
+// does not report their compressed size.
+struct RSSGUARD_DLLSPEC NetworkTransferStats {
+    int m_responses = 0;
+    int m_compressedResponses = 0;
+    qint64 m_decodedBytes = 0;
+
+    // Responses with which servers asked us to slow down and latest
+    // time (in msecs since epoch) until which they want us to wait.
+    int m_throttledResponses = 0;
+    qint64 m_throttledUntil = 0;
+
+    NetworkTransferStats operator-(const NetworkTransferStats& other) const;
+    NetworkTransferStats& operator+=(const NetworkTransferStats& other);
+};
+
+// Called when asynchronous network operation finishes.
+typedef std::function<void(const NetworkResult& result, const QByteArray& output)> NetworkCallback;
+
 class Downloader;
+class SilentNetworkAccessManager;
 
 class RSSGUARD_DLLSPEC NetworkFactory {
     Q_DECLARE_TR_FUNCTIONS(NetworkFactory)
@@ -85,6 +108,39 @@ class RSSGUARD_DLLSPEC NetworkFactory {
                                                  const QString& password = QString(),
                                                  const QNetworkProxy& custom_proxy =
                                                    QNetworkProxy::ProxyType::DefaultProxy);
+
+    // Performs ASYNCHRONOUS network operation. Callback is called in calling thread once
+    // the operation finishes, it is not called at all if "context" is destroyed before that.
+    // NOTE: "context" must live in calling thread which must run event loop.
+    static void performAsyncNetworkOperation(const QString& url,
+                                             int timeout,
+                                             const QByteArray& input_data,
+                                             QNetworkAccessManager::Operation operation,
+                                             const QList<QPair<QByteArray, QByteArray>>& additional_headers,
+                                             bool protected_contents,
+                                             const QString& username,
+                                             const QString& password,
+                                             const QNetworkProxy& custom_proxy,
+                                             const QObject* context,
+                                             const NetworkCallback& callback);
+
+    // Returns network manager shared by all network operations of calling thread,
+    // so that connections to servers are kept alive and reused.
+    static SilentNetworkAccessManager* threadNetworkManager();
+
+    // Makes shared network managers of all threads reload network settings.
+    static void reloadThreadNetworkManagers();
+
+    // Transfer statistics of calling thread, difference of two
+    // snapshots says how much data were received in between.
+    static NetworkTransferStats threadTransferStats();
+    static void countTransfer(QNetworkReply* reply);
+
+  private:
+    static void setupDownloader(Downloader& downloader,
+                                const QList<QPair<QByteArray, QByteArray>>& additional_headers,
+                                const QNetworkProxy& custom_proxy);
+    static NetworkResult downloaderResult(const Downloader& downloader);
 };
 
 Q_DECLARE_METATYPE(NetworkFactory::NetworkAuthentication)
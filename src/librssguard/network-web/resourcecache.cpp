@@ -0,0 +1,186 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#include "network-web/resourcecache.h"
+
+#include "definitions/definitions.h"
+#include "miscellaneous/application.h"
+#include "miscellaneous/settings.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+bool CachedResource::isFresh() const {
+  return m_fetchedAt.isValid() && m_fetchedAt.secsTo(QDateTime::currentDateTimeUtc()) < RESOURCE_CACHE_FRESHNESS;
+}
+
+ResourceCache::ResourceCache(QObject* parent)
+  : QObject(parent), m_diskSize(-1), m_diskHits(0), m_diskMisses(0), m_imageHits(0), m_imageMisses(0) {
+  m_images.setMaxCost(RESOURCE_CACHE_IMAGES_SIZE);
+}
+
+bool ResourceCache::resource(const QUrl& url, CachedResource& res) {
+  if (maximumDiskSize() <= 0) {
+    return false;
+  }
+
+  QFile fil(filePath(url));
+
+  if (!fil.open(QIODevice::OpenModeFlag::ReadOnly)) {
+    return false;
+  }
+
+  QDataStream str(&fil);
+  QUrl stored_url;
+
+  str.setVersion(QDataStream::Version::Qt_5_12);
+  str >> stored_url >> res.m_eTag >> res.m_lastModified >> res.m_fetchedAt >> res.m_data;
+
+  if (str.status() != QDataStream::Status::Ok || stored_url != url || res.m_data.isEmpty()) {
+    qWarningNN << LOGSEC_NETWORK << "Cached resource" << QUOTE_W_SPACE(url.toString()) << "is corrupted.";
+    res = {};
+    return false;
+  }
+
+  // Recently used entries are evicted last.
+  fil.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileTime::FileModificationTime);
+
+  if (res.isFresh()) {
+    m_diskHits++;
+  }
+
+  return true;
+}
+
+void ResourceCache::storeResource(const QUrl& url, const CachedResource& res) {
+  m_diskMisses++;
+  writeResource(url, res);
+}
+
+void ResourceCache::revalidateResource(const QUrl& url, const CachedResource& res) {
+  m_diskHits++;
+  writeResource(url, res);
+}
+
+QImage ResourceCache::image(const QString& key) {
+  QImage* img = m_images.object(key);
+
+  if (img == nullptr) {
+    m_imageMisses++;
+    return {};
+  }
+
+  m_imageHits++;
+  return *img;
+}
+
+void ResourceCache::storeImage(const QString& key, const QImage& image) {
+  m_images.insert(key, new QImage(image), qMax(1, int(image.sizeInBytes() / 1024)));
+}
+
+void ResourceCache::clear() {
+  m_images.clear();
+
+  if (!QDir(folder()).removeRecursively()) {
+    qWarningNN << LOGSEC_NETWORK << "Failed to remove cached resources from" << QUOTE_W_SPACE_DOT(folder());
+  }
+
+  m_diskSize = 0;
+}
+
+qint64 ResourceCache::diskSize() {
+  if (m_diskSize < 0) {
+    m_diskSize = 0;
+
+    const auto entries = QDir(folder()).entryInfoList(QDir::Filter::Files);
+
+    for (const QFileInfo& entry : entries) {
+      m_diskSize += entry.size();
+    }
+  }
+
+  return m_diskSize;
+}
+
+qint64 ResourceCache::diskHits() const {
+  return m_diskHits;
+}
+
+qint64 ResourceCache::diskMisses() const {
+  return m_diskMisses;
+}
+
+qint64 ResourceCache::imageHits() const {
+  return m_imageHits;
+}
+
+qint64 ResourceCache::imageMisses() const {
+  return m_imageMisses;
+}
+
+QString ResourceCache::folder() const {
+  return qApp->cacheFolder() + QDir::separator() + QSL("resources");
+}
+
+QString ResourceCache::filePath(const QUrl& url) const {
+  return folder() + QDir::separator() +
+         QString::fromLatin1(QCryptographicHash::hash(url.toEncoded(), QCryptographicHash::Algorithm::Sha1).toHex());
+}
+
+qint64 ResourceCache::maximumDiskSize() const {
+  return qApp->settings()->value(GROUP(Messages), SETTING(Messages::ResourcesCacheSize)).toLongLong() * 1024 * 1024;
+}
+
+void ResourceCache::writeResource(const QUrl& url, const CachedResource& res) {
+  if (maximumDiskSize() <= 0 || res.m_data.isEmpty()) {
+    return;
+  }
+
+  if (!QDir().mkpath(folder())) {
+    qWarningNN << LOGSEC_NETWORK << "Failed to create folder for cached resources" << QUOTE_W_SPACE_DOT(folder());
+    return;
+  }
+
+  QFile fil(filePath(url));
+  const qint64 old_size = fil.exists() ? fil.size() : 0;
+  const qint64 current_size = diskSize();
+
+  if (!fil.open(QIODevice::OpenModeFlag::WriteOnly | QIODevice::OpenModeFlag::Truncate)) {
+    qWarningNN << LOGSEC_NETWORK << "Failed to cache resource" << QUOTE_W_SPACE_DOT(url.toString());
+    return;
+  }
+
+  QDataStream str(&fil);
+
+  str.setVersion(QDataStream::Version::Qt_5_12);
+  str << url << res.m_eTag << res.m_lastModified << QDateTime::currentDateTimeUtc() << res.m_data;
+  fil.close();
+
+  m_diskSize = current_size - old_size + fil.size();
+
+  if (m_diskSize > maximumDiskSize()) {
+    trim();
+  }
+}
+
+void ResourceCache::trim() {
+  const qint64 target_size = maximumDiskSize() * 9 / 10;
+
+  // Least recently used entries go first.
+  const auto entries =
+    QDir(folder()).entryInfoList(QDir::Filter::Files, QDir::SortFlag::Time | QDir::SortFlag::Reversed);
+
+  for (const QFileInfo& entry : entries) {
+    if (m_diskSize <= target_size) {
+      break;
+    }
+
+    if (QFile::remove(entry.absoluteFilePath())) {
+      m_diskSize -= entry.size();
+    }
+  }
+
+  qDebugNN << LOGSEC_NETWORK << "Cached resources trimmed to" << QUOTE_W_SPACE(m_diskSize) << "bytes.";
+}
@@ -0,0 +1,69 @@
+// For license of this file, see <project-root-folder>/LICENSE.md.
+
+#ifndef RESOURCECACHE_H
+#define RESOURCECACHE_H
+
+#include <QCache>
+#include <QDateTime>
+#include <QImage>
+#include <QObject>
+#include <QUrl>
+
+#define RESOURCE_CACHE_FRESHNESS   86400 // In seconds.
+#define RESOURCE_CACHE_IMAGES_SIZE 65536 // In kB.
+
+struct CachedResource {
+    QByteArray m_data;
+    QByteArray m_eTag;
+    QByteArray m_lastModified;
+    QDateTime m_fetchedAt;
+
+    // Resource can be used without asking the server.
+    bool isFresh() const;
+};
+
+// Size-bounded LRU disk cache of external article resources
+// with small in-memory cache of already decoded pictures.
+class ResourceCache : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit ResourceCache(QObject* parent = nullptr);
+
+    // Returns cached resource if there is one, it might be stale.
+    bool resource(const QUrl& url, CachedResource& res);
+
+    // Stores freshly downloaded resource.
+    void storeResource(const QUrl& url, const CachedResource& res);
+
+    // Marks stale resource as fresh again because server confirmed it did not change.
+    void revalidateResource(const QUrl& url, const CachedResource& res);
+
+    QImage image(const QString& key);
+    void storeImage(const QString& key, const QImage& image);
+
+    void clear();
+
+    qint64 diskSize();
+    qint64 diskHits() const;
+    qint64 diskMisses() const;
+    qint64 imageHits() const;
+    qint64 imageMisses() const;
+
+  private:
+    QString folder() const;
+    QString filePath(const QUrl& url) const;
+    qint64 maximumDiskSize() const;
+    void writeResource(const QUrl& url, const CachedResource& res);
+    void trim();
+
+  private:
+    QCache<QString, QImage> m_images;
+    qint64 m_diskSize;
+    qint64 m_diskHits;
+    qint64 m_diskMisses;
+    qint64 m_imageHits;
+    qint64 m_imageMisses;
+};
+
+#endif // RESOURCECACHE_H
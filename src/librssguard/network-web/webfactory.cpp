@@ -10,7 +10,9 @@
 #include "network-web/apiserver.h"
 #include "network-web/articleparse.h"
 #include "network-web/cookiejar.h"
+#include "network-web/networkfactory.h"
 #include "network-web/readability.h"
+#include "network-web/resourcecache.h"
 
 #include <QDesktopServices>
 #include <QProcess>
@@ -56,6 +58,7 @@ WebFactory::WebFactory(QObject* parent) : QObject(parent), m_apiServer(nullptr),
   m_cookieJar = new CookieJar(this);
   m_readability = new Readability(this);
   m_articleParse = new ArticleParse(this);
+  m_resourceCache = new ResourceCache(this);
 
 #if defined(NO_LITE)
 #if QT_VERSION >= 0x050D00 // Qt >= 5.13.0
@@ -431,6 +434,9 @@ void WebFactory::updateProxy() {
 
     QNetworkProxy::setApplicationProxy(new_proxy);
   }
+
+  // Shared network managers of threads must pick up new proxy.
+  NetworkFactory::reloadThreadNetworkManagers();
 }
 
 AdBlockManager* WebFactory::adBlock() const {
@@ -570,6 +576,10 @@ Readability* WebFactory::readability() const {
   return m_readability;
 }
 
+ResourceCache* WebFactory::resourceCache() const {
+  return m_resourceCache;
+}
+
 ArticleParse* WebFactory::articleParse() const {
   return m_articleParse;
 }
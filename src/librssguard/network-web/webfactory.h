@@ -21,6 +21,7 @@ class CookieJar;
 class ApiServer;
 class Readability;
 class ArticleParse;
+class ResourceCache;
 
 class RSSGUARD_DLLSPEC WebFactory : public QObject {
     Q_OBJECT
@@ -52,6 +53,7 @@ class RSSGUARD_DLLSPEC WebFactory : public QObject {
     CookieJar* cookieJar() const;
     Readability* readability() const;
     ArticleParse* articleParse() const;
+    ResourceCache* resourceCache() const;
 
     void startApiServer();
     void stopApiServer();
@@ -98,6 +100,7 @@ class RSSGUARD_DLLSPEC WebFactory : public QObject {
     CookieJar* m_cookieJar;
     Readability* m_readability;
     ArticleParse* m_articleParse;
+    ResourceCache* m_resourceCache;
     QString m_customUserAgent;
 };
 
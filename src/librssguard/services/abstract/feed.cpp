@@ -17,7 +17,8 @@ Feed::Feed(RootItem* parent)
   : RootItem(parent), m_source(QString()), m_status(Status::Normal), m_statusString(QString()),
     m_autoUpdateType(AutoUpdateType::DefaultAutoUpdate), m_autoUpdateInterval(DEFAULT_AUTO_UPDATE_INTERVAL),
     m_lastUpdated(QDateTime::currentDateTimeUtc()), m_isSwitchedOff(false), m_isQuiet(false),
-    m_openArticlesDirectly(false), m_isRtl(false), m_messageFilters(QList<QPointer<MessageFilter>>()) {
+    m_openArticlesDirectly(false), m_isRtl(false), m_fetchOutcome(FetchOutcome::Downloaded),
+    m_messageFilters(QList<QPointer<MessageFilter>>()) {
   setKind(RootItem::Kind::Feed);
 }
 
@@ -43,6 +44,7 @@ Feed::Feed(const Feed& other) : RootItem(other) {
   setIsRtl(other.isRtl());
   setIsSwitchedOff(other.isSwitchedOff());
   setIsQuiet(other.isQuiet());
+  setFetchValidators(other.fetchValidators());
 }
 
 QList<Message> Feed::undeletedMessages() const {
@@ -224,6 +226,11 @@ void Feed::updateCounts(bool including_total_count) {
   setCountOfUnreadMessages(fc.m_unread);
 }
 
+void Feed::adjustCounts(int total_delta, int unread_delta) {
+  setCountOfAllMessages(std::max(countOfAllMessages() + total_delta, 0));
+  setCountOfUnreadMessages(std::max(countOfUnreadMessages() + unread_delta, 0));
+}
+
 bool Feed::cleanMessages(bool clean_read_only) {
   return getParentServiceRoot()->cleanFeeds(QList<Feed*>() << this, clean_read_only);
 }
@@ -251,9 +258,7 @@ QString Feed::getAutoUpdateStatusDescription() const {
     case AutoUpdateType::DefaultAutoUpdate:
       //: Describes feed auto-update status.
       if (qApp->feedReader()->autoUpdateEnabled()) {
-        int secs_to_next =
-          QDateTime::currentDateTimeUtc()
-            .secsTo(qApp->feedReader()->lastAutoUpdate().addSecs(qApp->feedReader()->autoUpdateInterval()));
+        int secs_to_next = QDateTime::currentDateTimeUtc().secsTo(qApp->feedReader()->nextAutoUpdate(this));
 
         auto_update_string =
           tr("uses global settings (%n minute(s) to next auto-fetch of articles)", nullptr, int(secs_to_next / 60.0));
@@ -267,7 +272,7 @@ QString Feed::getAutoUpdateStatusDescription() const {
 
     case AutoUpdateType::SpecificAutoUpdate:
     default:
-      int secs_to_next = QDateTime::currentDateTimeUtc().secsTo(lastUpdated().addSecs(autoUpdateInterval()));
+      int secs_to_next = QDateTime::currentDateTimeUtc().secsTo(qApp->feedReader()->nextAutoUpdate(this));
 
       //: Describes feed auto-update status.
       auto_update_string = tr("uses specific settings (%n minute(s) to next "
@@ -330,6 +335,22 @@ void Feed::setLastUpdated(const QDateTime& last_updated) {
   m_lastUpdated = last_updated;
 }
 
+Feed::FetchValidators Feed::fetchValidators() const {
+  return m_fetchValidators;
+}
+
+void Feed::setFetchValidators(const FetchValidators& validators) {
+  m_fetchValidators = validators;
+}
+
+Feed::FetchOutcome Feed::fetchOutcome() const {
+  return m_fetchOutcome;
+}
+
+void Feed::setFetchOutcome(FetchOutcome outcome) {
+  m_fetchOutcome = outcome;
+}
+
 bool Feed::isSwitchedOff() const {
   return m_isSwitchedOff;
 }
@@ -32,6 +32,21 @@ class RSSGUARD_DLLSPEC Feed : public RootItem {
         static ArticleIgnoreLimit fromSettings();
     };
 
+    // Data from last successful fetch of the feed used
+    // to avoid downloading and processing of unchanged feed data.
+    struct FetchValidators {
+        QString m_eTag;
+        QString m_lastModified;
+        QString m_contentHash;
+    };
+
+    // Says what happened during the last fetch of the feed.
+    enum class FetchOutcome {
+      Downloaded = 0,
+      NotModified = 1, // Server replied with HTTP/304.
+      Unchanged = 2    // Obtained data are identical to previous fetch.
+    };
+
     // Specifies the auto-download strategy for the feed.
     enum class AutoUpdateType {
       DontAutoUpdate = 0,
@@ -113,8 +128,15 @@ class RSSGUARD_DLLSPEC Feed : public RootItem {
     const ArticleIgnoreLimit& articleIgnoreLimit() const;
     void setArticleIgnoreLimit(const ArticleIgnoreLimit& ignore_limit);
 
+    FetchValidators fetchValidators() const;
+    void setFetchValidators(const FetchValidators& validators);
+
+    FetchOutcome fetchOutcome() const;
+    void setFetchOutcome(FetchOutcome outcome);
+
   public slots:
     virtual void updateCounts(bool including_total_count);
+    virtual void adjustCounts(int total_delta, int unread_delta);
 
   protected:
     QString getAutoUpdateStatusDescription() const;
@@ -138,6 +160,9 @@ class RSSGUARD_DLLSPEC Feed : public RootItem {
     // Amount
     ArticleIgnoreLimit m_articleIgnoreLimit;
 
+    FetchValidators m_fetchValidators;
+    FetchOutcome m_fetchOutcome;
+
     int m_totalCount{};
     int m_unreadCount{};
     QList<QPointer<MessageFilter>> m_messageFilters;
@@ -10,13 +10,17 @@
 FormAddEditProbe::FormAddEditProbe(QWidget* parent) : QDialog(parent), m_editableProbe(nullptr) {
   m_ui.setupUi(this);
   m_ui.m_txtName->lineEdit()->setPlaceholderText(tr("Name for your query"));
-  m_ui.m_txtFilter->lineEdit()->setPlaceholderText(tr("Regular expression"));
+  m_ui.m_cmbFilterType->addItem(tr("Regular expression"), int(Search::FilterType::RegularExpression));
+  m_ui.m_cmbFilterType->addItem(tr("Full-text query"), int(Search::FilterType::FullText));
 
   m_ui.m_help->setHelpText(
-    tr("What is regular expression?"),
+    tr("What is regular expression or full-text query?"),
     tr(
       "A regular expression (shortened as regex or regexp) is a sequence of characters that "
-      R"(specifies a match pattern in text. See more <a href="https://learn.microsoft.com/en-us/dotnet/standard/base-types/regular-expression-language-quick-reference">info</a>.)"),
+      R"(specifies a match pattern in text. See more <a href="https://learn.microsoft.com/en-us/dotnet/standard/base-types/regular-expression-language-quick-reference">info</a>.)"
+      "<br><br>"
+      "Full-text query is answered by search index of articles, so it is much faster. It consists of words, "
+      "\"quoted phrases\" and prefixes like \"news*\". Exact syntax depends on used database backend."),
     false,
     true);
 
@@ -29,20 +33,31 @@ FormAddEditProbe::FormAddEditProbe(QWidget* parent) : QDialog(parent), m_editabl
     }
   });
 
-  connect(m_ui.m_txtFilter->lineEdit(), &QLineEdit::textChanged, this, [this](const QString& text) {
-    if (text.isEmpty()) {
-      m_ui.m_txtFilter->setStatus(LineEditWithStatus::StatusType::Error, tr("Regular expression cannot be empty."));
-    }
-    else if (!QRegularExpression(text).isValid()) {
-      m_ui.m_txtFilter->setStatus(LineEditWithStatus::StatusType::Error, tr("Regular expression is not well-formed."));
-    }
-    else {
-      m_ui.m_txtFilter->setStatus(LineEditWithStatus::StatusType::Ok, tr("Perfect!"));
-    }
-  });
+  connect(m_ui.m_txtFilter->lineEdit(), &QLineEdit::textChanged, this, &FormAddEditProbe::validateFilter);
+  connect(m_ui.m_cmbFilterType,
+          static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
+          this,
+          &FormAddEditProbe::validateFilter);
 
   emit m_ui.m_txtName->lineEdit()->textChanged({});
-  emit m_ui.m_txtFilter->lineEdit()->textChanged({});
+  validateFilter();
+}
+
+void FormAddEditProbe::validateFilter() {
+  const QString text = m_ui.m_txtFilter->lineEdit()->text();
+  const bool full_text = m_ui.m_cmbFilterType->currentData().toInt() == int(Search::FilterType::FullText);
+
+  m_ui.m_txtFilter->lineEdit()->setPlaceholderText(full_text ? tr("Full-text query") : tr("Regular expression"));
+
+  if (text.isEmpty()) {
+    m_ui.m_txtFilter->setStatus(LineEditWithStatus::StatusType::Error, tr("Filter cannot be empty."));
+  }
+  else if (!full_text && !QRegularExpression(text).isValid()) {
+    m_ui.m_txtFilter->setStatus(LineEditWithStatus::StatusType::Error, tr("Regular expression is not well-formed."));
+  }
+  else {
+    m_ui.m_txtFilter->setStatus(LineEditWithStatus::StatusType::Ok, tr("Perfect!"));
+  }
 }
 
 Search* FormAddEditProbe::execForAdd() {
@@ -55,9 +70,11 @@ Search* FormAddEditProbe::execForAdd() {
   auto exit_code = exec();
 
   if (exit_code == QDialog::DialogCode::Accepted) {
-    return new Search(m_ui.m_txtName->lineEdit()->text(),
-                      m_ui.m_txtFilter->lineEdit()->text(),
-                      m_ui.m_btnColor->color());
+    auto* probe =
+      new Search(m_ui.m_txtName->lineEdit()->text(), m_ui.m_txtFilter->lineEdit()->text(), m_ui.m_btnColor->color());
+
+    probe->setFilterType(Search::FilterType(m_ui.m_cmbFilterType->currentData().toInt()));
+    return probe;
   }
   else {
     return nullptr;
@@ -74,6 +91,7 @@ bool FormAddEditProbe::execForEdit(Search* prb) {
   m_ui.m_btnColor->setColor(prb->color());
   m_ui.m_txtName->lineEdit()->setText(prb->title());
   m_ui.m_txtFilter->lineEdit()->setText(prb->filter());
+  m_ui.m_cmbFilterType->setCurrentIndex(m_ui.m_cmbFilterType->findData(int(prb->filterType())));
   m_ui.m_txtFilter->setFocus();
 
   auto exit_code = exec();
@@ -81,6 +99,7 @@ bool FormAddEditProbe::execForEdit(Search* prb) {
   if (exit_code == QDialog::DialogCode::Accepted) {
     m_editableProbe->setColor(m_ui.m_btnColor->color());
     m_editableProbe->setFilter(m_ui.m_txtFilter->lineEdit()->text());
+    m_editableProbe->setFilterType(Search::FilterType(m_ui.m_cmbFilterType->currentData().toInt()));
     m_editableProbe->setTitle(m_ui.m_txtName->lineEdit()->text());
     return true;
   }
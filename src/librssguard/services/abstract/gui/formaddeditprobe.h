@@ -23,6 +23,9 @@ class RSSGUARD_DLLSPEC FormAddEditProbe : public QDialog {
     Search* execForAdd();
     bool execForEdit(Search* prb);
 
+  private:
+    void validateFilter();
+
   private:
     Ui::FormAddEditProbe m_ui;
     Search* m_editableProbe;
@@ -80,6 +80,8 @@ void FormFeedDetails::apply() {
   if (!m_creatingNew) {
     m_serviceRoot->itemChanged(feeds<RootItem>());
   }
+
+  qApp->feedReader()->invalidateAutoUpdateSchedule();
 }
 
 QDialogButtonBox* FormFeedDetails::buttonBox() const {
@@ -34,6 +34,11 @@ void ImportantNode::updateCounts(bool including_total_count) {
   m_unreadCount = ac.m_unread;
 }
 
+void ImportantNode::adjustCounts(int total_delta, int unread_delta) {
+  m_totalCount = std::max(m_totalCount + total_delta, 0);
+  m_unreadCount = std::max(m_unreadCount + unread_delta, 0);
+}
+
 bool ImportantNode::cleanMessages(bool clean_read_only) {
   ServiceRoot* service = getParentServiceRoot();
   QSqlDatabase database = qApp->database()->driver()->connection(metaObject()->className());
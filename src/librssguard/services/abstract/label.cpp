@@ -73,6 +73,11 @@ void Label::updateCounts(bool including_total_count) {
   setCountOfUnreadMessages(ac.m_unread);
 }
 
+void Label::adjustCounts(int total_delta, int unread_delta) {
+  setCountOfAllMessages(std::max(m_totalCount + total_delta, 0));
+  setCountOfUnreadMessages(std::max(m_unreadCount + unread_delta, 0));
+}
+
 QList<Message> Label::undeletedMessages() const {
   QSqlDatabase database = qApp->database()->driver()->connection(metaObject()->className());
 
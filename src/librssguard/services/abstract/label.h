@@ -31,6 +31,7 @@ class RSSGUARD_DLLSPEC Label : public RootItem {
     virtual bool canBeDeleted() const;
     virtual bool deleteItem();
     virtual void updateCounts(bool including_total_count);
+    virtual void adjustCounts(int total_delta, int unread_delta);
     virtual QList<Message> undeletedMessages() const;
 
   public slots:
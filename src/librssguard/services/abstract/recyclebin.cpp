@@ -40,6 +40,11 @@ void RecycleBin::updateCounts(bool update_total_count) {
   }
 }
 
+void RecycleBin::adjustCounts(int total_delta, int unread_delta) {
+  m_totalCount = std::max(m_totalCount + total_delta, 0);
+  m_unreadCount = std::max(m_unreadCount + unread_delta, 0);
+}
+
 QList<QAction*> RecycleBin::contextMenuFeedsList() {
   if (m_contextMenu.isEmpty()) {
     QAction* restore_action =
@@ -20,6 +20,7 @@ class RSSGUARD_DLLSPEC RecycleBin : public RootItem {
     virtual int countOfUnreadMessages() const;
     virtual int countOfAllMessages() const;
     virtual void updateCounts(bool update_total_count);
+    virtual void adjustCounts(int total_delta, int unread_delta);
 
   public slots:
     virtual bool empty();
@@ -111,6 +111,13 @@ void RootItem::updateCounts(bool including_total_count) {
   }
 }
 
+void RootItem::adjustCounts(int total_delta, int unread_delta) {
+  Q_UNUSED(total_delta)
+  Q_UNUSED(unread_delta)
+
+  updateCounts(true);
+}
+
 int RootItem::row() const {
   if (m_parentItem != nullptr) {
     return m_parentItem->m_childItems.indexOf(const_cast<RootItem*>(this));
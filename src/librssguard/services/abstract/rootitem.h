@@ -104,6 +104,11 @@ class RSSGUARD_DLLSPEC RootItem : public QObject {
     // Reloads current counts of articles in this item from DB and
     // sets.
     virtual void updateCounts(bool including_total_count);
+
+    // Shifts current counts of articles by given numbers. Items which do not
+    // remember their counts simply recount them.
+    virtual void adjustCounts(int total_delta, int unread_delta);
+
     virtual int row() const;
     virtual QVariant data(int column, int role) const;
     virtual Qt::ItemFlags additionalFlags() const;
@@ -82,6 +82,14 @@ void Search::setFilter(const QString& new_filter) {
   m_filter = new_filter;
 }
 
+Search::FilterType Search::filterType() const {
+  return m_filterType;
+}
+
+void Search::setFilterType(FilterType type) {
+  m_filterType = type;
+}
+
 void Search::setCountOfAllMessages(int totalCount) {
   m_totalCount = totalCount;
 }
@@ -108,7 +116,10 @@ bool Search::cleanMessages(bool clear_only_read) {
 }
 
 QString Search::additionalTooltip() const {
-  return tr("Regular expression: %1").arg(QSL("<code>%1</code>").arg(filter()));
+  const QString code = QSL("<code>%1</code>").arg(filter());
+
+  return m_filterType == FilterType::FullText ? tr("Full-text query: %1").arg(code)
+                                              : tr("Regular expression: %1").arg(code);
 }
 
 bool Search::markAsReadUnread(RootItem::ReadStatus status) {
@@ -14,6 +14,14 @@ class RSSGUARD_DLLSPEC Search : public RootItem {
     Q_PROPERTY(QColor color READ color)
 
   public:
+    enum class FilterType {
+      // Filter is matched against article titles and contents.
+      RegularExpression = 0,
+
+      // Filter is query of full-text index, syntax depends on DB backend.
+      FullText = 1
+    };
+
     explicit Search(const QString& name, const QString& filter, const QColor& color, RootItem* parent_item = nullptr);
     explicit Search(RootItem* parent_item = nullptr);
 
@@ -23,6 +31,9 @@ class RSSGUARD_DLLSPEC Search : public RootItem {
     QString filter() const;
     void setFilter(const QString& new_filter);
 
+    FilterType filterType() const;
+    void setFilterType(FilterType type);
+
     void setCountOfAllMessages(int totalCount);
     void setCountOfUnreadMessages(int unreadCount);
 
@@ -39,6 +50,7 @@ class RSSGUARD_DLLSPEC Search : public RootItem {
 
   private:
     QString m_filter;
+    FilterType m_filterType = FilterType::RegularExpression;
     QColor m_color;
     int m_totalCount = -1;
     int m_unreadCount = -1;
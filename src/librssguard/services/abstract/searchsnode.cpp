@@ -3,6 +3,7 @@
 #include "services/abstract/searchsnode.h"
 
 #include "3rd-party/boolinq/boolinq.h"
+#include "core/probeengine.h"
 #include "database/databasefactory.h"
 #include "database/databasequeries.h"
 #include "exceptions/applicationexception.h"
@@ -76,6 +77,7 @@ void SearchsNode::createProbe() {
 
     try {
       DatabaseQueries::createProbe(db, new_prb, getParentServiceRoot()->accountId());
+      ProbeEngine::forCurrentThread()->matchProbe(db, new_prb, getParentServiceRoot()->accountId());
 
       getParentServiceRoot()->requestItemReassignment(new_prb, this);
       getParentServiceRoot()->requestItemExpand({this}, true);
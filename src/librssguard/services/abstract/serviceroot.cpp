@@ -4,6 +4,7 @@
 
 #include "3rd-party/boolinq/boolinq.h"
 #include "core/messagesmodel.h"
+#include "core/probeengine.h"
 #include "database/databasequeries.h"
 #include "definitions/globals.h"
 #include "exceptions/applicationexception.h"
@@ -127,6 +128,7 @@ void ServiceRoot::editItems(const QList<RootItem*>& items) {
       QSqlDatabase db = qApp->database()->driver()->connection(metaObject()->className());
 
       DatabaseQueries::updateProbe(db, probe);
+      ProbeEngine::forCurrentThread()->matchProbe(db, probe, accountId());
       updateCounts(probe);
       itemChanged({probe});
     }
@@ -390,9 +392,22 @@ ServiceRoot::LabelOperation ServiceRoot::supportedLabelOperations() const {
 }
 
 QString ServiceRoot::additionalTooltip() const {
-  return tr("Number of feeds: %1\n"
-            "Number of categories: %2")
-    .arg(QString::number(getSubTreeFeeds().size()), QString::number(getSubTreeCategories().size()));
+  QString tooltip = tr("Number of feeds: %1\n"
+                       "Number of categories: %2")
+                      .arg(QString::number(getSubTreeFeeds().size()), QString::number(getSubTreeCategories().size()));
+  auto upcoming = qApp->feedReader()->upcomingAutoUpdates(5, this);
+
+  if (!upcoming.isEmpty()) {
+    tooltip += QSL("\n") + tr("Upcoming auto-fetching:");
+
+    for (const auto& next : std::as_const(upcoming)) {
+      tooltip += QSL("\n  %1 - %2")
+                   .arg(QLocale().toString(next.first.toLocalTime(), QLocale::FormatType::ShortFormat),
+                        next.second->title());
+    }
+  }
+
+  return tooltip;
 }
 
 void ServiceRoot::saveAccountDataToDatabase() {
@@ -436,6 +451,10 @@ void ServiceRoot::aboutToBeginFeedFetching(const QList<Feed*>& feeds,
   Q_UNUSED(tagged_messages)
 }
 
+void ServiceRoot::feedFetchingFinished(const QList<Feed*>& feeds) {
+  Q_UNUSED(feeds)
+}
+
 void ServiceRoot::itemChanged(const QList<RootItem*>& items) {
   emit dataChanged(items);
 }
@@ -911,20 +930,23 @@ bool ServiceRoot::loadMessagesForItem(RootItem* item, MessagesModel* model) {
     item->updateCounts(true);
     itemChanged({item});
 
-    model->setFilter(QSL("Messages.is_deleted = 0 AND Messages.is_pdeleted = 0 AND Messages.account_id = %1 AND "
-                         "(Messages.title REGEXP '%2' OR Messages.contents REGEXP '%2')")
-                       .arg(QString::number(accountId()), item->toProbe()->filter()));
+    const QString fltr = QSL("'%1'").arg(DatabaseFactory::escapeQuery(item->toProbe()->filter()));
+
+    model->setFilter(QSL("Messages.is_deleted = 0 AND Messages.is_pdeleted = 0 AND Messages.account_id = %1 AND %2")
+                       .arg(QString::number(accountId()), DatabaseQueries::probeCondition(item->toProbe(), fltr)));
   }
   else if (item->kind() == RootItem::Kind::Label) {
     // Show messages with particular label.
     model->setFilter(QSL("Messages.is_deleted = 0 AND Messages.is_pdeleted = 0 AND "
-                         "Messages.labels LIKE \"%.%2.%\" AND Messages.account_id = %1")
-                       .arg(QString::number(accountId()), item->customId()));
+                         "Messages.id IN (SELECT message FROM LabelsInMessages WHERE label = '%2' AND "
+                         "account_id = %1) AND Messages.account_id = %1")
+                       .arg(QString::number(accountId()), DatabaseFactory::escapeQuery(item->customId())));
   }
   else if (item->kind() == RootItem::Kind::Labels) {
     // Show messages with any label.
     model->setFilter(QSL("Messages.is_deleted = 0 AND Messages.is_pdeleted = 0 AND "
-                         "LENGTH(Messages.labels) > 2 AND Messages.account_id = %1")
+                         "EXISTS (SELECT 1 FROM LabelsInMessages WHERE LabelsInMessages.message = Messages.id) AND "
+                         "Messages.account_id = %1")
                        .arg(QString::number(accountId())));
   }
   else if (item->kind() == RootItem::Kind::ServiceRoot) {
@@ -976,79 +998,84 @@ bool ServiceRoot::onBeforeSetMessagesRead(RootItem* selected_item,
 bool ServiceRoot::onAfterSetMessagesRead(RootItem* selected_item,
                                          const QList<Message>& messages,
                                          RootItem::ReadStatus read) {
-  Q_UNUSED(messages)
-  Q_UNUSED(read)
-
-  // We know that some messages were marked as read or unread, therefore we do not need to recount
-  // all items, but only some:
+  // We know that some messages were marked as read or unread and we know their
+  // previous states, therefore we do not need to recount anything, we only shift
+  // unread counts of some items:
   //  - recycle bin (if recycle bin IS selected)
   //  - feeds of those messages (if recycle bin is NOT selected)
   //  - important articles (if some messages IS important AND recycle bin is NOT selected)
-  //  - unread articles (if some messages IS unread AND recycle bin is NOT selected)
+  //  - unread articles (if recycle bin is NOT selected)
   //  - labels assigned to articles (if recycle bin is NOT selected)
   //  - probes (if recycle bin is NOT selected)
+  const bool mark_read = read == RootItem::ReadStatus::Read;
+  const int unread_delta = mark_read ? -1 : 1;
   QList<RootItem*> to_update;
 
   if (selected_item->kind() == RootItem::Kind::Bin) {
-    selected_item->updateCounts(false);
+    for (const Message& msg : messages) {
+      if (msg.m_isRead != mark_read) {
+        selected_item->adjustCounts(0, unread_delta);
+      }
+    }
+
     to_update << selected_item;
   }
   else {
-    auto linq = boolinq::from(messages);
+    QHash<QString, int> feed_deltas;
+    QHash<QString, int> label_deltas;
+    int important_delta = 0;
+    int total_delta = 0;
+
+    for (const Message& msg : messages) {
+      if (msg.m_isRead == mark_read) {
+        continue;
+      }
+
+      feed_deltas[msg.m_feedId] += unread_delta;
+      total_delta += unread_delta;
+
+      if (msg.m_isImportant) {
+        important_delta += unread_delta;
+      }
+
+      for (const QString& lbl : msg.m_assignedLabelsIds) {
+        label_deltas[lbl] += unread_delta;
+      }
+    }
 
     // 1. Feeds of messages.
-    auto feed_ids = linq
-                      .select([](const Message& msg) {
-                        return msg.m_feedId;
-                      })
-                      .distinct()
-                      .toStdList();
+    if (!feed_deltas.isEmpty()) {
+      auto feeds = getSubTreeFeeds();
 
-    for (const QString& feed_id : feed_ids) {
-      auto* feed = getItemFromSubTree([feed_id](const RootItem* it) {
-        return it->kind() == RootItem::Kind::Feed && it->customId() == feed_id;
-      });
+      for (Feed* feed : std::as_const(feeds)) {
+        auto delta = feed_deltas.constFind(feed->customId());
 
-      if (feed != nullptr) {
-        feed->updateCounts(false);
-        to_update << feed;
+        if (delta != feed_deltas.constEnd()) {
+          feed->adjustCounts(0, delta.value());
+          to_update << feed;
+        }
       }
     }
 
     // 2. Important.
-    if (importantNode() != nullptr) {
-      if (linq.any([](const Message& msg) {
-            return msg.m_isImportant;
-          })) {
-        importantNode()->updateCounts(false);
-        to_update << importantNode();
-      }
+    if (importantNode() != nullptr && important_delta != 0) {
+      importantNode()->adjustCounts(0, important_delta);
+      to_update << importantNode();
     }
 
     // 3. Unread.
-    if (unreadNode() != nullptr) {
-      unreadNode()->updateCounts(false);
+    if (unreadNode() != nullptr && total_delta != 0) {
+      unreadNode()->adjustCounts(0, total_delta);
       to_update << unreadNode();
     }
 
     // 4. Labels assigned.
     if (labelsNode() != nullptr) {
-      // auto db = qApp->database()->driver()->connection(metaObject()->className());
-      QStringList lbls; // = DatabaseQueries::getCountOfAssignedLabelsToMessages(db, messages, accountId());
-
-      for (const Message& msg : messages) {
-        for (const QString& lbl : msg.m_assignedLabelsIds) {
-          if (!lbls.contains(lbl)) {
-            lbls.append(lbl);
-          }
-        }
-      }
-
-      for (const QString& lbl : lbls) {
-        Label* l = labelsNode()->labelById(lbl);
+      for (auto i = label_deltas.constBegin(); i != label_deltas.constEnd(); i++) {
+        Label* l = labelsNode()->labelById(i.key());
 
         if (l != nullptr) {
-          l->updateCounts(false);
+          l->adjustCounts(0, i.value());
           to_update << l;
         }
       }
@@ -1096,15 +1123,31 @@ bool ServiceRoot::onBeforeSwitchMessageImportance(RootItem* selected_item, const
 
 bool ServiceRoot::onAfterSwitchMessageImportance(RootItem* selected_item, const QList<ImportanceChange>& changes) {
   Q_UNUSED(selected_item)
-  Q_UNUSED(changes)
 
   // NOTE: We know that some messages were marked as starred or unstarred. Starred count
   // is not displayed anywhere in feed list except "Important articles" item.
   auto in = importantNode();
 
   if (in != nullptr) {
+    int total_delta = 0;
+    int unread_delta = 0;
+
+    for (const ImportanceChange& change : changes) {
+      const bool will_be_important = change.second == RootItem::Importance::Important;
+
+      // Deleted articles are not counted in "Important articles".
+      if (change.first.m_isImportant == will_be_important || change.first.m_isDeleted) {
+        continue;
+      }
 
-    in->updateCounts(true);
+      total_delta += will_be_important ? 1 : -1;
+
+      if (!change.first.m_isRead) {
+        unread_delta += will_be_important ? 1 : -1;
+      }
+    }
+
+    in->adjustCounts(total_delta, unread_delta);
     itemChanged({in});
   }
 
@@ -1285,6 +1328,13 @@ UpdatedArticles ServiceRoot::updateMessages(QList<Message>& messages, Feed* feed
     qDebugNN << LOGSEC_CORE << "Updating messages in DB.";
 
     updated_messages = DatabaseQueries::updateMessages(database, messages, feed, force_update, db_mutex, &ok);
+
+    if (!ok) {
+      // Caller has to roll back and fetch the articles again.
+      throw ApplicationException(tr("failed to store articles of feed '%1'").arg(feed->customId()));
+    }
+
+    ProbeEngine::forCurrentThread()->matchArticles(database, accountId(), updated_messages.m_all);
   }
   else {
     qDebugNN << "No messages to be updated/added in DB for feed" << QUOTE_W_SPACE_DOT(feed->customId());
@@ -1292,10 +1342,40 @@ UpdatedArticles ServiceRoot::updateMessages(QList<Message>& messages, Feed* feed
 
   bool anything_removed = feed->removeUnwantedArticles(database);
 
-  if (anything_removed || !updated_messages.m_unread.isEmpty() || !updated_messages.m_all.isEmpty()) {
+  if (!anything_removed && updated_messages.m_countsDeltaValid) {
+    if (!updated_messages.m_all.isEmpty()) {
+      QMutexLocker lck(db_mutex);
+
+      // We know exactly how numbers changed, no need to recount them in DB.
+      feed->adjustCounts(updated_messages.m_feedCountsDelta.m_total, updated_messages.m_feedCountsDelta.m_unread);
+
+      if (recycleBin() != nullptr) {
+        recycleBin()->adjustCounts(updated_messages.m_binCountsDelta.m_total,
+                                   updated_messages.m_binCountsDelta.m_unread);
+      }
+
+      if (importantNode() != nullptr) {
+        importantNode()->adjustCounts(updated_messages.m_importantCountsDelta.m_total,
+                                      updated_messages.m_importantCountsDelta.m_unread);
+      }
+
+      if (unreadNode() != nullptr) {
+        unreadNode()->adjustCounts(0, updated_messages.m_feedCountsDelta.m_unread);
+      }
+
+      if (labelsNode() != nullptr && updated_messages.m_labelsChanged) {
+        labelsNode()->updateCounts(true);
+      }
+
+      if (probesNode() != nullptr) {
+        probesNode()->updateCounts(true);
+      }
+    }
+  }
+  else {
     QMutexLocker lck(db_mutex);
 
-    // Something was added or updated in the DB, update numbers.
+    // Something was removed or moved in the DB, update numbers.
     feed->updateCounts(true);
 
     if (recycleBin() != nullptr) {
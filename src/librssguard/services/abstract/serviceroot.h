@@ -81,6 +81,9 @@ class RSSGUARD_DLLSPEC ServiceRoot : public RootItem {
                                             stated_messages,
                                           const QHash<QString, QStringList>& tagged_messages);
 
+    // Called when articles of given feeds were fetched and stored in DB.
+    virtual void feedFetchingFinished(const QList<Feed*>& feeds);
+
     // Returns list of specific actions for "Add new item" main window menu.
     // So typical list of returned actions could look like:
     //  a) Add new feed
@@ -208,6 +211,7 @@ class RSSGUARD_DLLSPEC ServiceRoot : public RootItem {
     void completelyRemoveAllData();
 
     // Returns counts of updated messages <unread, all>.
+    // Throws ApplicationException if articles cannot be stored.
     UpdatedArticles updateMessages(QList<Message>& messages, Feed* feed, bool force_update, QMutex* db_mutex);
 
     QIcon feedIconForMessage(const QString& feed_custom_id) const;
@@ -30,6 +30,12 @@ void UnreadNode::updateCounts(bool including_total_count) {
   m_totalCount = m_unreadCount = DatabaseQueries::getUnreadMessageCounts(database, account_id);
 }
 
+void UnreadNode::adjustCounts(int total_delta, int unread_delta) {
+  Q_UNUSED(total_delta)
+
+  m_totalCount = m_unreadCount = std::max(m_unreadCount + unread_delta, 0);
+}
+
 bool UnreadNode::cleanMessages(bool clean_read_only) {
   if (clean_read_only) {
     return true;
@@ -14,6 +14,7 @@ class RSSGUARD_DLLSPEC UnreadNode : public RootItem {
     virtual QList<Message> undeletedMessages() const;
     virtual bool cleanMessages(bool clean_read_only);
     virtual void updateCounts(bool including_total_count);
+    virtual void adjustCounts(int total_delta, int unread_delta);
     virtual bool markAsReadUnread(ReadStatus status);
     virtual int countOfUnreadMessages() const;
     virtual int countOfAllMessages() const;